@@ -0,0 +1,10 @@
+echo "\033[1;33mMAP :\033[0m"
+./std_bench m > a
+./ft_bench m > b
+paste -d '\n' a b | sed 'N;s/\n/\t| ft /;s/^/std /'
+rm -rf a b
+echo "\033[1;33mVECTOR :\033[0m"
+./std_bench v > a
+./ft_bench v > b
+paste -d '\n' a b | sed 'N;s/\n/\t| ft /;s/^/std /'
+rm -rf a b
@@ -13,6 +13,13 @@
 #ifndef ALGO_HPP
 # define ALGO_HPP
 
+#include <cstring>
+#include "type_traits.hpp"
+
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
 namespace ft
 {
 	template<class InputIt1, class InputIt2>
@@ -33,14 +40,188 @@ namespace ft
 		return true;
 	}
 		
-	template<class InputIt>
-	size_t		iter_size(InputIt first, InputIt last)
+	template<class InputIt, class OutputIt>
+	OutputIt	copy(InputIt first, InputIt last, OutputIt d_first)
+	{
+		for (; first != last; ++first, (void) ++d_first)
+			*d_first = *first;
+		return (d_first);
+	}
+
+	template<class BidirIt1, class BidirIt2>
+	BidirIt2	copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+	{
+		while (first != last)
+			*(--d_last) = *(--last);
+		return (d_last);
+	}
+
+	template<class T>
+	T*			__copy_aux(const T* first, const T* last, T* d_first, true_type)
+	{
+		size_t n = last - first;
+
+		if (n != 0)
+			std::memmove(d_first, first, n * sizeof(T));
+		return (d_first + n);
+	}
+
+	template<class T>
+	T*			__copy_aux(const T* first, const T* last, T* d_first, false_type)
+	{
+		for (; first != last; ++first, (void) ++d_first)
+			*d_first = *first;
+		return (d_first);
+	}
+
+	template<class T>
+	T*			__copy_backward_aux(const T* first, const T* last, T* d_last, true_type)
+	{
+		size_t n = last - first;
+
+		if (n != 0)
+			std::memmove(d_last - n, first, n * sizeof(T));
+		return (d_last - n);
+	}
+
+	template<class T>
+	T*			__copy_backward_aux(const T* first, const T* last, T* d_last, false_type)
+	{
+		while (first != last)
+			*(--d_last) = *(--last);
+		return (d_last);
+	}
+
+	// Pointer ranges of trivially copyable types go through memmove, which
+	// also handles the overlap of in-place shifts.
+	template<class T>
+	T*			copy(const T* first, const T* last, T* d_first)
+	{
+		return (__copy_aux(first, last, d_first, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class T>
+	T*			copy(T* first, T* last, T* d_first)
+	{
+		return (__copy_aux(static_cast<const T*>(first), static_cast<const T*>(last), d_first, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class T>
+	T*			copy_backward(const T* first, const T* last, T* d_last)
 	{
-		size_t i = 0;
+		return (__copy_backward_aux(first, last, d_last, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class T>
+	T*			copy_backward(T* first, T* last, T* d_last)
+	{
+		return (__copy_backward_aux(static_cast<const T*>(first), static_cast<const T*>(last), d_last, typename is_trivially_copyable<T>::type()));
+	}
 
-		for (;first != last;++first)
-			i++;
-		return (i);
+	// Assigns src to dst, moving it when the language allows.
+	template<class T>
+	inline void	__move_assign(T& dst, T& src)
+	{
+#if __cplusplus >= 201103L
+		dst = std::move(src);
+#else
+		dst = src;
+#endif
+	}
+
+	template<class InputIt, class OutputIt>
+	OutputIt	__move_loop(InputIt first, InputIt last, OutputIt d_first)
+	{
+		for (; first != last; ++first, (void) ++d_first)
+			ft::__move_assign(*d_first, *first);
+		return (d_first);
+	}
+
+	template<class BidirIt1, class BidirIt2>
+	BidirIt2	__move_backward_loop(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+	{
+		while (first != last)
+			ft::__move_assign(*(--d_last), *(--last));
+		return (d_last);
+	}
+
+	// Bulk shifts for the containers: like copy and copy_backward, but the
+	// source is left in a moved-from state. Trivially copyable pointer
+	// ranges go through memmove, the rest is moved since C++11 and copied
+	// before.
+	template<class InputIt, class OutputIt>
+	OutputIt	move(InputIt first, InputIt last, OutputIt d_first)
+	{
+		return (ft::__move_loop(first, last, d_first));
+	}
+
+	template<class BidirIt1, class BidirIt2>
+	BidirIt2	move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+	{
+		return (ft::__move_backward_loop(first, last, d_last));
+	}
+
+	template<class T>
+	T*			__move_aux(T* first, T* last, T* d_first, true_type)
+	{
+		return (ft::__copy_aux(static_cast<const T*>(first), static_cast<const T*>(last), d_first, true_type()));
+	}
+
+	template<class T>
+	T*			__move_aux(T* first, T* last, T* d_first, false_type)
+	{
+		return (ft::__move_loop(first, last, d_first));
+	}
+
+	template<class T>
+	T*			move(T* first, T* last, T* d_first)
+	{
+		return (ft::__move_aux(first, last, d_first, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class T>
+	T*			__move_backward_aux(T* first, T* last, T* d_last, true_type)
+	{
+		return (ft::__copy_backward_aux(static_cast<const T*>(first), static_cast<const T*>(last), d_last, true_type()));
+	}
+
+	template<class T>
+	T*			__move_backward_aux(T* first, T* last, T* d_last, false_type)
+	{
+		return (ft::__move_backward_loop(first, last, d_last));
+	}
+
+	template<class T>
+	T*			move_backward(T* first, T* last, T* d_last)
+	{
+		return (ft::__move_backward_aux(first, last, d_last, typename is_trivially_copyable<T>::type()));
+	}
+
+	// Keeps the elements that do not match p, in order, at the front of the
+	// range and returns its new end: one pass, each survivor moved once.
+	template<class ForwardIt, class UnaryPredicate>
+	ForwardIt	remove_if(ForwardIt first, ForwardIt last, UnaryPredicate p)
+	{
+		for (; first != last && !p(*first); ++first) ;
+		if (first == last)
+			return (first);
+
+		ForwardIt	result = first;
+
+		for (++first; first != last; ++first)
+			if (!p(*first))
+			{
+				ft::__move_assign(*result, *first);
+				++result;
+			}
+		return (result);
+	}
+
+	template<class ForwardIt, class T>
+	void		fill(ForwardIt first, ForwardIt last, const T& value)
+	{
+		for (; first != last; ++first)
+			*first = value;
 	}
 
 	template<class InputIt1, class InputIt2>
@@ -13,42 +13,123 @@
 #ifndef TREE_HPP
 # define TREE_HPP
 
-# define NODE_TYPE_RED 		1
-# define NODE_TYPE_BLACK 	2
-# define NODE_TYPE_NIL		NULL
-
+#include <memory>
 #include "pair.hpp"
 #include "common.hpp"
-#include "vector.hpp"
 #include "algorithm.hpp"
 
 namespace ft
 {
 
-	enum AVLTree_pos { right = false, left = true };
+	// Node layouts. Both hold the child links, the parent link and the
+	// balance factor (height of the right subtree minus the left one, -1,
+	// 0 or 1), and mark the tree header so iterators can recognize end().
+	// The header's parent is the root, its left/right the leftmost and
+	// rightmost nodes.
+	//
+	// node_base keeps the four-word footprint of a red-black node, the
+	// balance sitting where the color would be.
+	struct node_base
+	{
+		typedef node_base*		base_pointer;
+
+		int				balance_factor;
+		base_pointer	left;
+		base_pointer 	right;
+		base_pointer 	parent_link;
+
+		node_base() : balance_factor(0), left(NULL), right(NULL), parent_link(NULL) {}
+
+		base_pointer	parent() const
+		{
+			return (this->parent_link);
+		}
+
+		void			set_parent(base_pointer p)
+		{
+			this->parent_link = p;
+		}
+
+		int				balance() const
+		{
+			return (this->balance_factor);
+		}
+
+		void			set_balance(int b)
+		{
+			this->balance_factor = b;
+		}
+
+		bool			is_header() const
+		{
+			return (this->balance_factor == 2);
+		}
+
+		void			make_header()
+		{
+			this->balance_factor = 2;
+		}
+	};
 
-	template<class T>
-	struct node
+	// compact_node_base stores the balance, biased to 0..2, in the two low
+	// bits of the parent pointer (3 marks the header): three words per node.
+	struct compact_node_base
+	{
+		typedef compact_node_base*	base_pointer;
+
+		base_pointer	left;
+		base_pointer 	right;
+		size_t			parent_bits;
+
+		compact_node_base() : left(NULL), right(NULL), parent_bits(1) {}
+
+		base_pointer	parent() const
+		{
+			return (reinterpret_cast<base_pointer>(this->parent_bits & ~size_t(3)));
+		}
+
+		void			set_parent(base_pointer p)
+		{
+			this->parent_bits = reinterpret_cast<size_t>(p) | (this->parent_bits & 3);
+		}
+
+		int				balance() const
+		{
+			return (static_cast<int>(this->parent_bits & 3) - 1);
+		}
+
+		void			set_balance(int b)
+		{
+			this->parent_bits = (this->parent_bits & ~size_t(3)) | static_cast<size_t>(b + 1);
+		}
+
+		bool			is_header() const
+		{
+			return ((this->parent_bits & 3) == 3);
+		}
+
+		void			make_header()
+		{
+			this->parent_bits |= 3;
+		}
+	};
+
+	template<class T, class NodeBase = ft::node_base>
+	struct node : public NodeBase
 	{
 		typedef T					value_type;
 		typedef value_type&			reference;
 		typedef const value_type&	const_reference;
 		typedef struct node*		node_pointer;
-		
-		AVLTree_pos		color;
-		node_pointer	left;
-		node_pointer 	right;
-		node_pointer 	parent;
+
 		value_type		value;
 		
-		node() : left(NULL), right(NULL), parent(NULL), value(NULL) {}
-		node(const value_type &_value_type) : left(NULL), right(NULL), parent(NULL), value(_value_type) {}
-		node(node_pointer parent, const value_type &_value_type) : left(NULL), right(NULL), parent(parent), value(_value_type) {}
-		node(const node	&src) : left(src.left), right(src.right), parent(src.parent), value(src.value) {}
+		node(const value_type &_value_type) : NodeBase(), value(_value_type) {}
+		node(const node	&src) : NodeBase(src), value(src.value) {}
 	};
-	
-	template<typename T>
-	node<T>*	increment_tree_node(node<T>* n)
+
+	template<class NodeBase>
+	inline NodeBase*	increment_tree_node(NodeBase* n)
 	{
 		if (n->right != NULL)
 		{
@@ -58,14 +139,12 @@ namespace ft
 		}
 		else
 		{
-			node<T>* tmp = n->parent;
+			NodeBase* tmp = n->parent();
 			
 			while (n == tmp->right)
 			{
-				if (!tmp->parent)
-					return (n);
 				n = tmp;
-				tmp = tmp->parent;
+				tmp = tmp->parent();
 			}
 			if (n->right != tmp)
 				n = tmp;
@@ -73,9 +152,11 @@ namespace ft
 		return (n);
 	}
 
-	template<typename T>
-	node<T>*	decrement_tree_node(node<T>* n)
+	template<class NodeBase>
+	inline NodeBase*	decrement_tree_node(NodeBase* n)
 	{
+		if (n->is_header())
+			return (n->right);
 		if (n->left != NULL)
 		{
 			n = n->left;
@@ -84,27 +165,19 @@ namespace ft
 		}
 		else
 		{
-			node<T>* tmp = n->parent;
+			NodeBase* tmp = n->parent();
 
 			while (n == tmp->left)
 			{
-				if (!tmp->parent)
-				{
-					while (n->parent)
-						n = n->parent;
-					while (n->right)
-						n = n->right;
-					return (n->parent);
-				}
 				n = tmp;
-				tmp = tmp->parent;
+				tmp = tmp->parent();
 			}
 			n = tmp;
 		}
 		return (n);
 	}
 
-	template<typename T>
+	template<typename T, class NodeBase = ft::node_base>
 	struct	AVLTree_iterator
 	{
 		typedef T							value_type;
@@ -112,46 +185,47 @@ namespace ft
 		typedef T*							pointer;
 		typedef bidirectional_iterator_tag	iterator_category;
       	typedef ptrdiff_t                 	difference_type;
-		typedef struct node<T>*				node_pointer;
-		typedef AVLTree_iterator<T>			self;
+		typedef struct node<T, NodeBase>*	node_pointer;
+		typedef NodeBase*					base_pointer;
+		typedef AVLTree_iterator<T, NodeBase>	self;
 
 		AVLTree_iterator() : current() {}
 
-		AVLTree_iterator(node_pointer src) : current(src) {}
+		AVLTree_iterator(base_pointer src) : current(src) {}
 
 		reference			operator*() const
 		{
-			return (this->current->value);
+			return (static_cast<node_pointer>(this->current)->value);
 		}
 
 		pointer				operator->() const
 		{
-			return (&(this->current->value));
+			return (&(static_cast<node_pointer>(this->current)->value));
 		}
 
 		self&	operator++()
 		{
-			this->current = ft::increment_tree_node<value_type>(this->current);
+			this->current = ft::increment_tree_node(this->current);
 			return (*this);
 		}
 
 		self	operator++(int)
 		{
 			self	tmp = *this;
-			this->current = ft::increment_tree_node<value_type>(this->current);
+			this->current = ft::increment_tree_node(this->current);
 			return (tmp);
 		}
 
 		self&	operator--()
 		{
-			this->current = ft::decrement_tree_node<value_type>(this->current);
+			this->current = ft::decrement_tree_node(this->current);
 			return (*this);
 		}
 
 		self	operator--(int)
 		{
 			self tmp = *this;
-			this->current = ft::decrement_tree_node<value_type>(this->current);
+			this->current = ft::decrement_tree_node(this->current);
 			return (tmp);
 		}
 
@@ -166,35 +240,36 @@ namespace ft
 		}
 		
 		public:
-			node_pointer current;
+			base_pointer current;
 	};
 
-	template<typename T>
+	template<typename T, class NodeBase = ft::node_base>
 	struct	AVLTree_const_iterator
 	{
 		typedef T							value_type;
 		typedef const value_type&			reference;
 		typedef const T*					pointer;
 		typedef bidirectional_iterator_tag	iterator_category;
-		typedef AVLTree_iterator<T>			iterator;
+		typedef AVLTree_iterator<T, NodeBase>	iterator;
       	typedef ptrdiff_t                 	difference_type;
-		typedef struct node<T>*				node_pointer;
-		typedef AVLTree_const_iterator<T>	self;
+		typedef struct node<T, NodeBase>*	node_pointer;
+		typedef NodeBase*					base_pointer;
+		typedef AVLTree_const_iterator<T, NodeBase>	self;
 	
 		AVLTree_const_iterator() : current() {}
 
-		AVLTree_const_iterator(node_pointer src) : current(src) {}
+		AVLTree_const_iterator(base_pointer src) : current(src) {}
 
 		AVLTree_const_iterator(const iterator& src) : current(src.current) {}
 
 		reference			operator*() const
 		{
-			return (this->current->value);
+			return (static_cast<node_pointer>(this->current)->value);
 		}
 
 		pointer				operator->() const
 		{
-			return (&(this->current->value));
+			return (&(static_cast<node_pointer>(this->current)->value));
 		}
 
 		self&	operator++()
@@ -234,174 +309,300 @@ namespace ft
 		}
 		
 		public:
-			node_pointer current;
+			base_pointer current;
 	};
 
-	template<class V, class T, class Key, class Compare>
+	// KeyOfValue pulls the key out of a stored value (ft::identity for
+	// sets, ft::select_first for maps). With UniqueKeys false the tree
+	// keeps equivalent keys side by side, in insertion order.
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator = std::allocator<V>, class NodeBase = ft::node_base, bool UniqueKeys = true>
 	class AVLTree
 	{
 		public:
 			typedef Key															key_type;
-			typedef T															mapped_type;
 			typedef V															value_type;
+			typedef KeyOfValue													key_of_value;
 			typedef Compare														key_compare;
 			typedef	size_t														size_type;
-			typedef struct node<value_type>										node;
+			typedef struct node<value_type, NodeBase>							node;
 			typedef node*														node_pointer;
-			typedef typename std::allocator<node>								node_allocator_type;
+			typedef NodeBase*													base_pointer;
+			typedef typename Allocator::template rebind<node>::other			node_allocator_type;
 			typedef value_type&													reference;
 			typedef const value_type&											const_reference;
 		  public:
-			typedef ft::AVLTree_iterator<value_type>      					 	iterator;
-			typedef ft::AVLTree_const_iterator<value_type> 						const_iterator;
+			typedef ft::AVLTree_iterator<value_type, NodeBase>					iterator;
+			typedef ft::AVLTree_const_iterator<value_type, NodeBase>			const_iterator;
 			typedef ft::reverse_iterator<iterator>       						reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator> 						const_reverse_iterator;
 		public:
-			AVLTree() : root(NULL), left_eot(NULL), right_eot(NULL) , nodes_count(0), compare(), allocator()
+			AVLTree(const key_compare& comp = key_compare(), const Allocator& alloc = Allocator()) : header(), nodes_count(0), compare(comp), allocator(alloc)
 			{
-				this->create_eot();
+				this->reset_header();
 			}
 
 			~AVLTree()
 			{
-				this->destroy_eot();
-				this->destroy(this->root);
+				this->destroy(this->root());
 			}
 		public:
-			node_pointer	find(node_pointer root, key_type key)
+			static const key_type&	key(base_pointer n)
 			{
-				if (this->nodes_count == 0)
-					return (NULL);
-				if (root && root->value.first == key)
-					return (root);
-				else if (root->left != NULL && this->left_eot != root->left && this->compare(key, root->value.first))
-					return (this->find(root->left, key));
-				else if (root->right != NULL && this->right_eot != root->right)
-					return (this->find(root->right, key));
-				else
-					return (NULL);
+				return (key_of_value()(static_cast<node_pointer>(n)->value));
 			}
 
-			node_pointer	find(node_pointer root, key_type key) const
+			// Whether a key may sit before b: strictly less with unique
+			// keys, not greater otherwise.
+			bool			ordered(const key_type& a, const key_type& b) const
 			{
-				if (this->nodes_count == 0)
-					return (NULL);
-				if (root && root->value.first == key)
-					return (root);
-				else if (root->left != NULL && this->left_eot != root->left && this->compare(key, root->value.first))
-					return (this->find(root->left, key));
-				else if (root->right != NULL && this->right_eot != root->right)
-					return (this->find(root->right, key));
-				else
-					return (NULL);
+				if (UniqueKeys)
+					return (this->compare(a, b));
+				return (!this->compare(b, a));
 			}
-		
-			node_pointer	find(const key_type& key)
+
+			base_pointer	end_node() const
+			{
+				return (const_cast<base_pointer>(&this->header));
+			}
+
+			base_pointer	root() const
 			{
-				return (this->find(this->root, key));
+				return (this->header.parent());
 			}
 
+			void			reset_header()
+			{
+				this->header.set_parent(NULL);
+				this->header.make_header();
+				this->header.left = &this->header;
+				this->header.right = &this->header;
+			}
+
+			// One comparison per level down to the lower bound, then a single
+			// equivalence check on it.
 			node_pointer	find(const key_type& key) const
 			{
-				return (this->find(this->root, key));
+				base_pointer	n = this->lower_bound(this->root(), NULL, key);
+
+				if (n != NULL && !this->compare(key, this->key(n)))
+					return (static_cast<node_pointer>(n));
+				return (NULL);
 			}
-			
-			node_pointer	find_parent(node_pointer root, const_reference v)
+
+			// Single descent: returns the node holding key if there is one,
+			// otherwise NULL with parent/to_left set to the insertion slot.
+			node_pointer	find_insert_pos(const key_type& key, base_pointer& parent, bool& to_left) const
 			{
-				if (this->nodes_count == 0)
-					return (NULL);
+				base_pointer	n = this->root();
+				base_pointer	candidate = NULL;
+
+				parent = this->end_node();
+				to_left = false;
+				while (n != NULL)
+				{
+					parent = n;
+					to_left = this->compare(key, this->key(n));
+					if (to_left)
+						n = n->left;
+					else
+					{
+						candidate = n;
+						n = n->right;
+					}
+				}
+				if (candidate != NULL && !this->compare(this->key(candidate), key))
+					return (static_cast<node_pointer>(candidate));
+				return (NULL);
+			}
+
+			node_pointer	insert_at(base_pointer parent, bool to_left, const_reference v)
+			{
+				node_pointer	new_node = this->allocator.allocate(1);
 
-				if (this->compare(v.first, root->value.first))
+				try
 				{
-					if (root->left == NULL)
-						return (root);
-					return (this->find_parent(root->left, v));
+					this->allocator.construct(new_node, node(v));
+				}
+				catch (...)
+				{
+					this->allocator.deallocate(new_node, 1);
+					throw ;
+				}
+				new_node->set_parent(parent);
+				if (parent == &this->header)
+				{
+					this->header.set_parent(new_node);
+					this->header.left = new_node;
+					this->header.right = new_node;
+				}
+				else if (to_left)
+				{
+					parent->left = new_node;
+					if (parent == this->header.left)
+						this->header.left = new_node;
 				}
 				else
 				{
-					if (root->right == NULL)
-						return (root);
-					return (this->find_parent(root->right, v));
+					parent->right = new_node;
+					if (parent == this->header.right)
+						this->header.right = new_node;
 				}
+				this->nodes_count++;
+				this->rebalance_insert(new_node);
+				return (new_node);
 			}
 			
-			int		max(int a, int b)
+			void	replace_child(base_pointer n, base_pointer child)
 			{
-				return (a > b ? a : b);
-			}
+				base_pointer	parent = n->parent();
 
-			int		depth(node_pointer n)
-			{
-				if (n == NULL)
-					return (0);
-				return (1 + max(this->depth(n->left), this->depth(n->right)));
+				if (parent == &this->header)
+					this->header.set_parent(child);
+				else if (parent->left == n)
+					parent->left = child;
+				else
+					parent->right = child;
 			}
 
-			void	rotate_left(node_pointer n)
+			// Rotations only relink; balance factors are set by rotate_fix.
+			base_pointer	rotate_left(base_pointer n)
 			{
-				if (n == NULL) return ;
-				node_pointer right = n->right;
+				base_pointer right = n->right;
 
-				if (n->parent != NULL)
-				{
-					if (n->parent->right == n)
-						n->parent->right = right;
-					else
-						n->parent->left = right;
-				}
-				right->parent = n->parent;
+				this->replace_child(n, right);
+				right->set_parent(n->parent());
 				if (right->left != NULL)
-					right->left->parent = n;
+					right->left->set_parent(n);
 				n->right = right->left;
-				n->parent = right;
+				n->set_parent(right);
 				right->left = n;
-				if (n == this->root)
-					this->root = right;
+				return (right);
 			}
 
-			void	rotate_right(node_pointer n)
+			base_pointer	rotate_right(base_pointer n)
 			{
-				if (n == NULL) return ;
-				node_pointer left = n->left;
+				base_pointer left = n->left;
 
-				if (n->parent != NULL)
-				{
-					if (n->parent->left == n)
-						n->parent->left = left;
-					else
-						n->parent->right = left;
-				}
-				left->parent = n->parent;
+				this->replace_child(n, left);
+				left->set_parent(n->parent());
 				if (left->right != NULL)
-					left->right->parent = n;
+					left->right->set_parent(n);
 				n->left = left->right;
-				n->parent = left;
+				n->set_parent(left);
 				left->right = n;
-				if (n == this->root)
-					this->root = left;
+				return (left);
 			}
 
-			void	rebalance(node_pointer n)
+			// Restores n, whose balance would be bf (2 or -2), with a single
+			// or double rotation, and returns the new subtree root. The
+			// out-of-range factor is never stored, so it fits in two bits.
+			base_pointer	rotate_fix(base_pointer n, int bf)
 			{
-				if (n == NULL) return ;
-
-				int	depth = this->depth(n->right) - this->depth(n->left);
-				if (depth == 2)
+				if (bf > 0)
 				{
-					if (this->depth(n->right->right) - this->depth(n->right->left) == -1)
-						this->rotate_right(n->right);
+					base_pointer	right = n->right;
+					int				rb = right->balance();
+
+					if (rb >= 0)
+					{
+						this->rotate_left(n);
+						n->set_balance(1 - rb);
+						right->set_balance(rb - 1);
+						return (right);
+					}
+
+					base_pointer	pivot = right->left;
+					int				pb = pivot->balance();
+
+					this->rotate_right(right);
 					this->rotate_left(n);
+					n->set_balance(pb > 0 ? -1 : 0);
+					right->set_balance(pb < 0 ? 1 : 0);
+					pivot->set_balance(0);
+					return (pivot);
 				}
-				else if (depth == -2)
+
+				base_pointer	left = n->left;
+				int				lb = left->balance();
+
+				if (lb <= 0)
 				{
-					if (this->depth(n->left->right) - this->depth(n->left->left) == 1)
-						this->rotate_left(n->left);
 					this->rotate_right(n);
+					n->set_balance(-1 - lb);
+					left->set_balance(lb + 1);
+					return (left);
 				}
-				this->rebalance(n->parent);
+
+				base_pointer	pivot = left->right;
+				int				pb = pivot->balance();
+
+				this->rotate_left(left);
+				this->rotate_right(n);
+				n->set_balance(pb < 0 ? 1 : 0);
+				left->set_balance(pb > 0 ? -1 : 0);
+				pivot->set_balance(0);
+				return (pivot);
 			}
 
-			node_pointer	maximum(node_pointer n)
+			// Walks up from the new leaf n while subtree heights grow; stops
+			// at the first ancestor that absorbs the growth or after one
+			// rotation.
+			void	rebalance_insert(base_pointer n)
+			{
+				base_pointer	parent = n->parent();
+
+				while (parent != &this->header)
+				{
+					int	bf = parent->balance() + (n == parent->left ? -1 : 1);
+
+					if (bf == 0)
+					{
+						parent->set_balance(0);
+						return ;
+					}
+					if (bf == 2 || bf == -2)
+					{
+						this->rotate_fix(parent, bf);
+						return ;
+					}
+					parent->set_balance(bf);
+					n = parent;
+					parent = n->parent();
+				}
+			}
+
+			// Walks up from n, whose left (or right) subtree just lost one
+			// level, while subtree heights shrink.
+			void	rebalance_erase(base_pointer n, bool left_shrunk)
+			{
+				while (n != &this->header)
+				{
+					int	bf = n->balance() + (left_shrunk ? 1 : -1);
+
+					if (bf == 1 || bf == -1)
+					{
+						n->set_balance(bf);
+						return ;
+					}
+					if (bf == 0)
+						n->set_balance(0);
+					else
+					{
+						int	sibling_bf = (bf > 0 ? n->right : n->left)->balance();
+
+						n = this->rotate_fix(n, bf);
+						if (sibling_bf == 0)
+							return ;
+					}
+
+					base_pointer	parent = n->parent();
+
+					left_shrunk = (n == parent->left);
+					n = parent;
+				}
+			}
+
+			static base_pointer	maximum(base_pointer n)
 			{
 				if (n == NULL)
 					return (NULL);
@@ -410,216 +611,359 @@ namespace ft
 				return (n);
 			}
 
-			void			destroy_eot()
+			static base_pointer	minimum(base_pointer n)
 			{
-				this->remove_eot();
-				if (this->right_eot)
-				{
-					this->destroy_node(this->right_eot);
-					this->right_eot = NULL;
-				}
-				if (this->left_eot)
-				{
-					this->destroy_node(this->left_eot);
-					this->left_eot = NULL;
-				}
+				if (n == NULL)
+					return (NULL);
+				while (n->left != NULL)
+					n = n->left;
+				return (n);
 			}
 
-			void			create_eot()
+			base_pointer	maximum() const
 			{
-				if (!this->right_eot)
-				{
-					this->right_eot = this->allocator.allocate(1);
-					this->allocator.construct(this->right_eot, node(value_type()));
-				}
-				if (!this->left_eot)
-				{
-					this->left_eot = this->allocator.allocate(1);
-					this->allocator.construct(this->left_eot, node(value_type()));
-				}
+				return (this->header.right);
 			}
 
-			void			remove_eot()
+			base_pointer	minimum() const
 			{
-				if (this->right_eot && this->right_eot->parent)
-				{
-					this->right_eot->parent->right = NULL;
-					this->right_eot->parent = NULL;
-				}
-				if (this->left_eot && this->left_eot->parent)
-				{
-					this->left_eot->parent->left = NULL;
-					this->left_eot->parent = NULL;
-				}
+				return (this->header.left);
+			}
+
+			base_pointer	lower_bound(const key_type& key) const
+			{
+				return (this->lower_bound(this->root(), this->end_node(), key));
 			}
 
-			void			add_eot()
+			base_pointer	upper_bound(const key_type& key) const
 			{
-				node_pointer r = this->maximum();
-				node_pointer l = this->minimum();
+				return (this->upper_bound(this->root(), this->end_node(), key));
+			}
 
-				if (r)
+			// Descend from n; end is returned when every key is below the bound.
+			base_pointer	lower_bound(base_pointer n, base_pointer end, const key_type& key) const
+			{
+				while (n != NULL)
 				{
-					r->right = this->right_eot;
-					this->right_eot->parent = r;
+					if (!this->compare(this->key(n), key))
+						end = n, n = n->left;
+					else
+						n = n->right;
 				}
-				if (l)
+				return (end);
+			}
+
+			base_pointer	upper_bound(base_pointer n, base_pointer end, const key_type& key) const
+			{
+				while (n != NULL)
 				{
-					l->left = this->left_eot;
-					this->left_eot->parent = l;
+					if (this->compare(key, this->key(n)))
+						end = n, n = n->left;
+					else
+						n = n->right;
 				}
+				return (end);
+			}
+
+			// With equal keys the new node goes after its equivalents, so
+			// the second member is always true.
+			ft::pair<node_pointer, bool>	insert(const_reference v)
+			{
+				base_pointer	parent;
+				bool			to_left;
+				node_pointer	found = this->find_insert_pos(key_of_value()(v), parent, to_left);
+
+				if (found != NULL && UniqueKeys)
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(this->insert_at(parent, to_left, v), true));
 			}
 
+			// Range insert: an empty tree fed sorted forward input (without
+			// duplicates, in unique mode) is built balanced in O(n); anything
+			// else goes through append_range.
+			template<class InputIt>
+			void	insert_range(InputIt first, InputIt last)
+			{
+				this->insert_range(first, last, ft::iterator_category(first));
+			}
 
-			node_pointer	maximum()
+			template<class InputIt>
+			void	insert_range(InputIt first, InputIt last, ft::input_iterator_tag)
 			{
-				return (this->maximum(this->root));
+				this->append_range(first, last);
 			}
 
-			node_pointer	maximum() const
+			template<class ForwardIt>
+			void	insert_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
 			{
-				return (this->maximum(this->root));
+				size_type	count;
+
+				if (this->nodes_count == 0 && this->is_sorted_unique(first, last, count))
+					this->build_sorted(first, count);
+				else
+					this->append_range(first, last);
 			}
 
-			node_pointer	minimum(node_pointer n)
+			// Same as insert_range, but the caller guarantees the input is
+			// sorted (and unique, in unique mode).
+			template<class InputIt>
+			void	insert_sorted(InputIt first, InputIt last)
 			{
-				if (n == NULL)
-					return (NULL);
-				while (n->left != NULL)
-					n = n->left;
-				return (n);
+				this->insert_sorted(first, last, ft::iterator_category(first));
 			}
 
-			node_pointer	minimum()
+			template<class InputIt>
+			void	insert_sorted(InputIt first, InputIt last, ft::input_iterator_tag)
 			{
-				return (this->minimum(this->root));
+				this->append_range(first, last);
 			}
 
-			node_pointer	minimum() const
+			template<class ForwardIt>
+			void	insert_sorted(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
 			{
-				return (this->minimum(this->root));
+				if (this->nodes_count == 0)
+					this->build_sorted(first, ft::distance(first, last));
+				else
+					this->append_range(first, last);
 			}
 
-			node_pointer	lower_bound(const Key& key)
+			// Hinted at end(), so ascending input skips the descent.
+			template<class InputIt>
+			void	append_range(InputIt first, InputIt last)
 			{
-				if (!this->root)
-					return (NULL);
-				node_pointer 	begin = this->minimum()->parent;
-				node_pointer	end = this->maximum()->parent;
-				return (this->lower_bound(begin, end, key));
+				for (;first != last;++first)
+					this->insert_hint(this->end_node(), *first);
 			}
 
-			node_pointer	upper_bound(const Key& key)
+			// Counts the range while checking it, so sorted input costs a
+			// single extra pass.
+			template<class ForwardIt>
+			bool	is_sorted_unique(ForwardIt first, ForwardIt last, size_type& count) const
 			{
-				if (!this->root)
-					return (NULL);
-				node_pointer 	begin = this->minimum()->parent;
-				node_pointer	end = this->maximum()->parent;
-				return (this->upper_bound(begin, end, key));
+				count = 0;
+				if (first == last)
+					return (true);
+				for (ForwardIt prev = first;++count, ++first != last;prev = first)
+					if (!this->ordered(key_of_value()(*prev), key_of_value()(*first)))
+						return (false);
+				return (true);
 			}
 
-			node_pointer	lower_bound(node_pointer begin, node_pointer end, const Key& key)
+			template<class ForwardIt>
+			void	build_sorted(ForwardIt first, size_type count)
 			{
-				while (begin != NULL && begin != this->left_eot && begin != this->right_eot)
+				if (count == 0)
+					return ;
+				int	height;
+
+				this->header.set_parent(this->build(first, count, &this->header, height));
+				this->header.left = this->minimum(this->root());
+				this->header.right = this->maximum(this->root());
+				this->nodes_count = count;
+			}
+
+			// Builds a perfectly balanced subtree from the next count elements,
+			// in order: left half, then the middle element, then right half.
+			// height receives the subtree height.
+			template<class ForwardIt>
+			base_pointer	build(ForwardIt& it, size_type count, base_pointer parent, int& height)
+			{
+				if (count == 0)
 				{
-					if (!this->compare(begin->value.first, key))
-						end = begin, begin = begin->left;
-					else
-						begin = begin->right;
+					height = 0;
+					return (NULL);
 				}
-				return (end);
+
+				int				left_height;
+				int				right_height;
+				base_pointer	left = this->build(it, count / 2, NULL, left_height);
+				node_pointer	n = this->allocator.allocate(1);
+
+				try
+				{
+					this->allocator.construct(n, node(*it));
+				}
+				catch (...)
+				{
+					this->allocator.deallocate(n, 1);
+					this->destroy(left);
+					throw ;
+				}
+				++it;
+				n->set_parent(parent);
+				n->left = left;
+				if (left != NULL)
+					left->set_parent(n);
+				try
+				{
+					n->right = this->build(it, count - count / 2 - 1, n, right_height);
+				}
+				catch (...)
+				{
+					this->destroy(n);
+					throw ;
+				}
+				n->set_balance(right_height - left_height);
+				height = 1 + (left_height > right_height ? left_height : right_height);
+				return (n);
 			}
 
-			node_pointer	upper_bound(node_pointer begin, node_pointer end, const Key& key)
+			// When v belongs right next to hint (just before it, or at the end
+			// for end()), it is linked there with two comparisons at most;
+			// a wrong hint falls back to the normal descent. With equal keys,
+			// v lands as close before hint as the order allows.
+			node_pointer	insert_hint(base_pointer hint, const_reference v)
 			{
-				while (begin != NULL && begin != this->left_eot && begin != this->right_eot)
+				const key_type&	k = key_of_value()(v);
+
+				if (hint == &this->header)
 				{
-					if (this->compare(key, begin->value.first))
-						end = begin, begin = begin->left;
-					else
-						begin = begin->right;
+					if (this->nodes_count != 0 && this->ordered(this->key(this->header.right), k))
+						return (this->insert_at(this->header.right, false, v));
 				}
-				return (end);
+				else if (this->ordered(k, this->key(hint)))
+				{
+					if (hint == this->header.left)
+						return (this->insert_at(hint, true, v));
+
+					base_pointer	before = ft::decrement_tree_node(hint);
+
+					if (this->ordered(this->key(before), k))
+					{
+						if (before->right == NULL)
+							return (this->insert_at(before, false, v));
+						return (this->insert_at(hint, true, v));
+					}
+				}
+				else if (this->compare(this->key(hint), k))
+				{
+					if (hint == this->header.right)
+						return (this->insert_at(hint, false, v));
+
+					base_pointer	after = ft::increment_tree_node(hint);
+
+					if (this->ordered(k, this->key(after)))
+					{
+						if (hint->right == NULL)
+							return (this->insert_at(hint, false, v));
+						return (this->insert_at(after, true, v));
+					}
+					if (!UniqueKeys)
+						return (this->insert_before(this->lower_bound(k), v));
+				}
+				else
+					return (static_cast<node_pointer>(hint));
+				return (this->insert(v).first);
 			}
 
-			int		insert(const_reference v)
+			// Links v as the in-order predecessor of pos (end() included).
+			node_pointer	insert_before(base_pointer pos, const_reference v)
 			{
-				if (this->find(this->root, v.first))
-					return (0);
-				this->remove_eot();
-				node_pointer	potential_parent = this->find_parent(this->root, v);
-				node_pointer	new_node = this->allocator.allocate(1);
+				if (pos == &this->header)
+					return (this->insert_at(this->header.right, false, v));
+				if (pos->left == NULL)
+					return (this->insert_at(pos, true, v));
+				return (this->insert_at(this->maximum(pos->left), false, v));
+			}
 
-				this->allocator.construct(new_node, node(potential_parent, v));
-				if (new_node == NULL)
-					return (0);
-				if (potential_parent == NULL)
-					this->root = new_node;
-				else if (this->compare(new_node->value.first, potential_parent->value.first))
-					potential_parent->left = new_node;
-				else
-					potential_parent->right = new_node;
-				this->nodes_count++;
-				this->rebalance(new_node);
-				this->add_eot();
-				return (1);
+			// Each node is unlinked in place as the range is walked: no key
+			// copies, no allocation and no search from the root. The whole
+			// tree is simply destroyed.
+			void	remove(const_iterator first, const_iterator last)
+			{
+				if (first.current == this->header.left && last.current == &this->header)
+				{
+					this->destroy();
+					return ;
+				}
+				while (first != last)
+					this->remove_node((first++).current);
 			}
 
-			int		remove(iterator first, iterator last)
+			void	remove_node(base_pointer n)
 			{
-				// temp solution, make better solution !
-				vector<key_type> v;
+				this->unlink(n);
+				this->destroy_node(static_cast<node_pointer>(n));
+			}
 
-				for (;first != last;++first)
-					v.push_back(first->first);
-				for (typename vector<Key>::iterator it = v.begin();it != v.end();++it)
-					this->remove(*it);
-				return (1);
+			size_type	remove(const key_type& key)
+			{
+				if (UniqueKeys)
+				{
+					node_pointer	n = this->find(key);
+
+					if (n == NULL)
+						return (0);
+					this->remove_node(n);
+					return (1);
+				}
+
+				base_pointer	n = this->lower_bound(key);
+				base_pointer	last = this->upper_bound(key);
+				size_type		count = 0;
+
+				for (;n != last;count++)
+				{
+					base_pointer	next = ft::increment_tree_node(n);
+
+					this->remove_node(n);
+					n = next;
+				}
+				return (count);
 			}
 
-			int		remove(key_type key)
+			size_type	count(const key_type& key) const
 			{
-				node_pointer node;
-				node_pointer node_parent;
+				if (UniqueKeys)
+					return (this->find(key) != NULL ? 1 : 0);
+				return (ft::distance(const_iterator(this->lower_bound(key)), const_iterator(this->upper_bound(key))));
+			}
 
-				if (!(node = this->find(this->root, key)))
-					return (0);
-				this->remove_eot();
-				node_parent = node->parent;
-				if (this->nodes_count > 1)
+			// Detaches n from the tree without touching its value: a node with
+			// two children is replaced by its in-order predecessor.
+			void		unlink(base_pointer n)
+			{
+				base_pointer	from;
+				bool			left_shrunk;
+
+				if (n == this->header.left)
+					this->header.left = n->right != NULL ? this->minimum(n->right) : n->parent();
+				if (n == this->header.right)
+					this->header.right = n->left != NULL ? this->maximum(n->left) : n->parent();
+				if (n->left != NULL && n->right != NULL)
 				{
-					node_pointer max = this->maximum(node->left);
+					base_pointer	max = this->maximum(n->left);
 
-					if (max == NULL)
-					{
-						if (node == this->root)
-							this->root = node->right;
-						else if (node->parent->left == node)
-							node->parent->left = node->right;
-						else
-							node->parent->right = node->right;
-						if (node->right != NULL)
-							node->right->parent = node->parent;
-					}
+					from = max->parent();
+					left_shrunk = (from == n);
+					if (from == n)
+						from = max;
 					else
 					{
-						node->value = max->value;
-						if (max->parent->left == max)
-							max->parent->left = max->left;
-						else
-							max->parent->right = max->left;
+						from->right = max->left;
 						if (max->left != NULL)
-							max->left->parent = max->parent;
-						node = max;
+							max->left->set_parent(from);
+						max->left = n->left;
+						n->left->set_parent(max);
 					}
-					this->rebalance(node_parent);
+					max->right = n->right;
+					n->right->set_parent(max);
+					this->replace_child(n, max);
+					max->set_parent(n->parent());
+					max->set_balance(n->balance());
 				}
 				else
-					this->root = NULL;
-				this->add_eot();
+				{
+					base_pointer	child = n->left != NULL ? n->left : n->right;
+
+					from = n->parent();
+					left_shrunk = (n == from->left);
+					this->replace_child(n, child);
+					if (child != NULL)
+						child->set_parent(from);
+				}
 				this->nodes_count--;
-				this->destroy_node(node);
-				return (1);
+				this->rebalance_erase(from, left_shrunk);
 			}
 
 			void		destroy_node(node_pointer n)
@@ -628,7 +972,7 @@ namespace ft
 				this->allocator.deallocate(n, 1);
 			}
 
-			void		destroy(node_pointer n)
+			void		destroy(base_pointer n)
 			{
 				if (n == NULL) return ;
 				
@@ -636,15 +980,53 @@ namespace ft
 					destroy(n->left);
 				if (n->right != NULL)
 					destroy(n->right);
-				this->destroy_node(n);
-				this->nodes_count--;
+				this->destroy_node(static_cast<node_pointer>(n));
 			}
 
 			void		destroy(void)
 			{
-				this->remove_eot();
-				this->destroy(this->root);
-				this->root = NULL;
+				this->destroy(this->root());
+				this->reset_header();
+				this->nodes_count = 0;
+			}
+
+			// Replaces the content with a node-for-node clone of other: O(n),
+			// no comparisons or rotations. Our current nodes are recycled
+			// before any new one is allocated.
+			void		copy(const AVLTree& other)
+			{
+				if (this == &other)
+					return ;
+
+				base_pointer	reuse = this->flatten();
+
+				try
+				{
+					if (other.root() != NULL)
+					{
+						this->header.set_parent(this->clone(other.root(), &this->header, reuse));
+						this->header.left = this->minimum(this->root());
+						this->header.right = this->maximum(this->root());
+						this->nodes_count = other.nodes_count;
+					}
+				}
+				catch (...)
+				{
+					this->destroy_list(reuse);
+					throw ;
+				}
+				this->destroy_list(reuse);
+				this->compare = other.compare;
+			}
+
+			void		swap(AVLTree& other)
+			{
+				ft::swap(&this->header, &other.header);
+				ft::swap(&this->nodes_count, &other.nodes_count);
+				ft::swap(&this->compare, &other.compare);
+				ft::swap(&this->allocator, &other.allocator);
+				this->fix_header();
+				other.fix_header();
 			}
 
 			size_type	size() const
@@ -659,22 +1041,22 @@ namespace ft
 
 			iterator 				begin()
 			{
-				return iterator(this->left_eot ? this->left_eot->parent : this->left_eot);
+				return iterator(this->header.left);
 			}
 
 			const_iterator			begin() const
 			{
-				return const_iterator(this->left_eot ? this->left_eot->parent : this->left_eot);
+				return const_iterator(this->header.left);
 			}
 			
 			iterator 				end()
 			{
-				return iterator(this->right_eot ? this->right_eot : this->left_eot);
+				return iterator(this->end_node());
 			}
 
 			const_iterator			end() const
 			{
-				return const_iterator(this->right_eot ? this->right_eot : this->left_eot);
+				return const_iterator(this->end_node());
 			}
 			
 			reverse_iterator		rend()
@@ -696,59 +1078,168 @@ namespace ft
 			{
 				return const_reverse_iterator(this->end());
 			}
+		private:
+			// Unhooks every node into a list chained through right pointers,
+			// rotating left children up so no stack is needed, and leaves
+			// the tree empty.
+			base_pointer	flatten()
+			{
+				base_pointer	list = NULL;
+				base_pointer	n = this->root();
+
+				while (n != NULL)
+				{
+					if (n->left != NULL)
+					{
+						base_pointer	left = n->left;
+
+						n->left = left->right;
+						left->right = n;
+						n = left;
+					}
+					else
+					{
+						base_pointer	next = n->right;
+
+						n->right = list;
+						list = n;
+						n = next;
+					}
+				}
+				this->reset_header();
+				this->nodes_count = 0;
+				return (list);
+			}
+
+			void			destroy_list(base_pointer list)
+			{
+				while (list != NULL)
+				{
+					base_pointer	next = list->right;
+
+					this->destroy_node(static_cast<node_pointer>(list));
+					list = next;
+				}
+			}
+
+			node_pointer	clone_node(base_pointer src, base_pointer& reuse)
+			{
+				node_pointer	n;
+
+				if (reuse != NULL)
+				{
+					n = static_cast<node_pointer>(reuse);
+					reuse = reuse->right;
+					try
+					{
+						n->value = static_cast<node_pointer>(src)->value;
+					}
+					catch (...)
+					{
+						this->destroy_node(n);
+						throw ;
+					}
+				}
+				else
+				{
+					n = this->allocator.allocate(1);
+					try
+					{
+						this->allocator.construct(n, node(static_cast<node_pointer>(src)->value));
+					}
+					catch (...)
+					{
+						this->allocator.deallocate(n, 1);
+						throw ;
+					}
+				}
+				n->left = NULL;
+				n->right = NULL;
+				n->set_balance(src->balance());
+				return (n);
+			}
+
+			base_pointer	clone(base_pointer src, base_pointer parent, base_pointer& reuse)
+			{
+				node_pointer	n = this->clone_node(src, reuse);
+
+				n->set_parent(parent);
+				try
+				{
+					if (src->left != NULL)
+						n->left = this->clone(src->left, n, reuse);
+					if (src->right != NULL)
+						n->right = this->clone(src->right, n, reuse);
+				}
+				catch (...)
+				{
+					this->destroy(n);
+					throw ;
+				}
+				return (n);
+			}
+
+			// After a raw header swap, links that still point at the other
+			// tree's header (the root's parent, or the header itself when
+			// empty) are rebound to ours.
+			void		fix_header()
+			{
+				if (this->root() == NULL)
+					this->reset_header();
+				else
+					this->root()->set_parent(&this->header);
+			}
 		public:
-			node_pointer		root;
-			node_pointer		left_eot;
-			node_pointer		right_eot;
+			NodeBase			header;
 			size_type			nodes_count;
 			key_compare			compare;
 			node_allocator_type	allocator;
 	};
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator==(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator==(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()));
     }
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator<(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator<(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()));
     }
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator!=(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator!=(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (!(x == y));
     }
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator>(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator>(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (y < x);
     }
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator>=(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator>=(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (!(x < y));
     }
 
-	template<class V, class T, class Key, class Compare>
-    inline bool operator<=(const AVLTree<V, T, Key, Compare>& x, const AVLTree<V, T, Key, Compare>& y)
+	template<class V, class Key, class KeyOfValue, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+    inline bool operator<=(const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& x, const AVLTree<V, Key, KeyOfValue, Compare, Allocator, NodeBase, UniqueKeys>& y)
     {
       return (!(y < x));
     }
 
-	template<typename T>
-    inline bool	operator==(const AVLTree_iterator<T>& x, const AVLTree_iterator<T>& y)
+	template<typename T, class NodeBase>
+    inline bool	operator==(const AVLTree_iterator<T, NodeBase>& x, const AVLTree_iterator<T, NodeBase>& y)
     {
 		return (x.current == y.current);
 	}
 
-  	template<typename T>
-    inline bool	operator!=(const AVLTree_const_iterator<T>& x, const AVLTree_const_iterator<T>& y)
+  	template<typename T, class NodeBase>
+    inline bool	operator!=(const AVLTree_const_iterator<T, NodeBase>& x, const AVLTree_const_iterator<T, NodeBase>& y)
     {
 		return (x.current != y.current);
 	}
@@ -0,0 +1,756 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/10 11:02:14 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/10 11:02:14 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <ctime>
+#include <cstdlib>
+#include <string>
+#include <sstream>
+#include <memory>
+
+#ifndef FT_VERSION
+# define FT_VERSION 1
+#endif
+
+#include "pool_allocator.hpp"
+
+#if FT_VERSION == 1
+	#define TESTED_NAMESPACE ft
+	#include "map.hpp"
+	#include "vector.hpp"
+	#include "stack.hpp"
+	#include "small_vector.hpp"
+	#include "flat_map.hpp"
+	#include "static_map.hpp"
+	#include "unordered_map.hpp"
+	#include "set.hpp"
+#else
+	#define TESTED_NAMESPACE std
+	#include <map>
+	#include <set>
+	#include <vector>
+	#include <stack>
+# if __cplusplus >= 201103L
+	#include <unordered_map>
+# endif
+#endif
+
+#define BENCH_MAP_SIZE	1000000
+
+static clock_t	g_start;
+static size_t	g_allocated;
+
+// std::allocator that tracks the bytes it currently hands out.
+template<class T>
+struct counting_allocator : public std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T*		allocate(size_t n, const void* = 0)
+	{
+		g_allocated += n * sizeof(T);
+		return (std::allocator<T>::allocate(n));
+	}
+
+	void	deallocate(T* p, size_t n)
+	{
+		g_allocated -= n * sizeof(T);
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+void	bench_start(void)
+{
+	g_start = clock();
+}
+
+void	bench_stop(const char *name)
+{
+	double ms = (double)(clock() - g_start) * 1000.0 / CLOCKS_PER_SEC;
+
+	std::cout << name << ": " << ms << " ms" << std::endl;
+}
+
+void	bench_map(void)
+{
+	TESTED_NAMESPACE::map<int, int>	m;
+	int								*keys = new int[BENCH_MAP_SIZE];
+
+	srand(42);
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		keys[i] = rand();
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m.insert(TESTED_NAMESPACE::make_pair(i, i));
+	bench_stop("map insert 1M ascending");
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m.erase(i);
+	bench_stop("map erase 1M ascending");
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], i));
+	bench_stop("map insert 1M random");
+
+	{
+		bench_start();
+		TESTED_NAMESPACE::map<int, int>	copy(m);
+		bench_stop("map copy construct 1M");
+
+		bench_start();
+		copy = m;
+		for (int i = 0;i < 4;i++)
+		{
+			copy[i] = i;
+			copy = m;
+		}
+		bench_stop("map copy assign 1M x5");
+	}
+
+	{
+		TESTED_NAMESPACE::map<int, int>	plain;
+		TESTED_NAMESPACE::map<int, int>	hinted;
+
+		bench_start();
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+			plain.insert(TESTED_NAMESPACE::make_pair(i, i));
+		bench_stop("map append 1M no hint");
+
+		bench_start();
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+			hinted.insert(hinted.end(), TESTED_NAMESPACE::make_pair(i, i));
+		bench_stop("map append 1M hint end()");
+	}
+
+	{
+		TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, int> >	sorted;
+
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+			sorted.push_back(TESTED_NAMESPACE::make_pair(i, i));
+		bench_start();
+		TESTED_NAMESPACE::map<int, int>	from_vector(sorted.begin(), sorted.end());
+		bench_stop("map range construct 1M sorted vector");
+
+		bench_start();
+		TESTED_NAMESPACE::map<int, int>	from_map(m.begin(), m.end());
+		bench_stop("map range construct 1M from map");
+	}
+
+	{
+		TESTED_NAMESPACE::map<int, int>	expiring(m);
+
+		bench_start();
+		for (int i = 0;i < 100;i++)
+			expiring.erase(expiring.begin(), expiring.lower_bound(RAND_MAX / 100 * (i + 1)));
+		bench_stop("map erase range 1M in 100 slices");
+
+		bench_start();
+		for (TESTED_NAMESPACE::map<int, int>::iterator it = m.begin();it != m.end();)
+			m.erase(it++);
+		bench_stop("map erase(iterator) 1M");
+	}
+
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m.insert(TESTED_NAMESPACE::make_pair(keys[i], i));
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m.erase(keys[i]);
+	bench_stop("map erase 1M random");
+
+	delete[] keys;
+}
+
+template<class Map>
+void	bench_map_churn(const char *churn_name, const char *iterate_name)
+{
+	Map		m;
+	long	sum = 0;
+
+	srand(42);
+	bench_start();
+	for (int round = 0;round < 4;round++)
+	{
+		for (int i = 0;i < BENCH_MAP_SIZE / 4;i++)
+			m[rand() % BENCH_MAP_SIZE] = i;
+		for (int i = 0;i < BENCH_MAP_SIZE / 4;i++)
+			m.erase(rand() % BENCH_MAP_SIZE);
+	}
+	bench_stop(churn_name);
+
+	bench_start();
+	for (int round = 0;round < 10;round++)
+		for (typename Map::iterator it = m.begin();it != m.end();++it)
+			sum += it->second;
+	bench_stop(iterate_name);
+	std::cout << "(" << sum << ")" << std::endl;
+}
+
+void	bench_map_pool(void)
+{
+	typedef ft::pool_allocator<TESTED_NAMESPACE::pair<const int, int> >	pool;
+
+	bench_map_churn<TESTED_NAMESPACE::map<int, int> >("map churn 1M insert/erase", "map iterate x10");
+	bench_map_churn<TESTED_NAMESPACE::map<int, int, TESTED_NAMESPACE::less<int>, pool> >("map<pool_allocator> churn 1M insert/erase", "map<pool_allocator> iterate x10");
+}
+
+template<class Map>
+void	bench_map_bytes(const char *name)
+{
+	Map		m;
+	size_t	before = g_allocated;
+
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m[i] = i;
+	std::cout << name << ": " << (double)(g_allocated - before) / m.size() << " bytes/entry" << std::endl;
+}
+
+void	bench_map_memory(void)
+{
+	typedef counting_allocator<TESTED_NAMESPACE::pair<const int, int> >	counting;
+
+	bench_map_bytes<TESTED_NAMESPACE::map<int, int, TESTED_NAMESPACE::less<int>, counting> >("map<int, int> 1M");
+#if FT_VERSION == 1
+	typedef ft::map<int, int, ft::less<int>, counting, ft::compact_node_base>	compact;
+
+	bench_map_bytes<compact>("map<int, int, compact_node_base> 1M");
+	bench_map_churn<compact>("map<compact_node_base> churn 1M insert/erase", "map<compact_node_base> iterate x10");
+#else
+	std::cout << "map<int, int, compact_node_base> 1M: n/a" << std::endl;
+	std::cout << "map<compact_node_base> churn 1M insert/erase: n/a" << std::endl;
+	std::cout << "map<compact_node_base> iterate x10: n/a" << std::endl << "(n/a)" << std::endl;
+#endif
+}
+
+void	bench_map_string(void)
+{
+	TESTED_NAMESPACE::map<std::string, int>	m;
+	std::string								*keys = new std::string[BENCH_MAP_SIZE / 4];
+	long									hits = 0;
+
+	srand(42);
+	for (int i = 0;i < BENCH_MAP_SIZE / 4;i++)
+	{
+		std::ostringstream	ss;
+
+		ss << "session-key-" << rand();
+		keys[i] = ss.str();
+		m[keys[i]] = i;
+	}
+
+	bench_start();
+	for (int round = 0;round < 4;round++)
+		for (int i = 0;i < BENCH_MAP_SIZE / 4;i++)
+			hits += m.find(keys[i]) != m.end();
+	bench_stop("map<string> find 1M hits");
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE / 4;i++)
+		hits += m.count(keys[i] + "x");
+	bench_stop("map<string> count 250k misses");
+
+	std::cout << "(" << hits << ")" << std::endl;
+	delete[] keys;
+}
+
+// Half the table comes in bulk through a sorted range insert, then
+// lookups hit and miss one key in two.
+template<class Map>
+void	bench_lookup(const std::string& name)
+{
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, int> >	evens;
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, int> >	odds;
+	int															*keys = new int[BENCH_MAP_SIZE];
+	long														sum = 0;
+
+	for (int i = 0;i < BENCH_MAP_SIZE / 2;i++)
+	{
+		evens.push_back(TESTED_NAMESPACE::make_pair(i * 4, i));
+		odds.push_back(TESTED_NAMESPACE::make_pair(i * 4 + 2, i));
+	}
+	srand(42);
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		keys[i] = rand() % (BENCH_MAP_SIZE * 4);
+
+	Map		m(evens.begin(), evens.end());
+
+	bench_start();
+	m.insert(odds.begin(), odds.end());
+	bench_stop((name + " insert 500k sorted into 500k").c_str());
+
+	bench_start();
+	for (int round = 0;round < 4;round++)
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+			sum += m.find(keys[i]) != m.end();
+	bench_stop((name + " find 4M random").c_str());
+
+	bench_start();
+	for (int round = 0;round < 4;round++)
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		{
+			typename Map::iterator	it = m.lower_bound(keys[i]);
+
+			sum += it == m.end() ? 0 : it->second;
+		}
+	bench_stop((name + " lower_bound 4M random").c_str());
+
+	std::cout << "(" << sum << ")" << std::endl;
+	delete[] keys;
+}
+
+void	bench_flat_map(void)
+{
+	bench_lookup<TESTED_NAMESPACE::map<int, int> >("map");
+#if FT_VERSION == 1
+	bench_lookup<ft::flat_map<int, int> >("flat_map");
+#else
+	std::cout << "flat_map insert 500k sorted into 500k: n/a" << std::endl;
+	std::cout << "flat_map find 4M random: n/a" << std::endl;
+	std::cout << "flat_map lower_bound 4M random: n/a" << std::endl << "(n/a)" << std::endl;
+#endif
+}
+
+// Same table and keys as bench_lookup.
+void	bench_static_map(void)
+{
+#if FT_VERSION == 1
+	ft::vector<ft::pair<int, int> >	table;
+	int								*keys = new int[BENCH_MAP_SIZE];
+	long							sum = 0;
+
+	for (int i = 0;i < BENCH_MAP_SIZE / 2;i++)
+	{
+		table.push_back(ft::make_pair(i * 4, i));
+		table.push_back(ft::make_pair(i * 4 + 2, i));
+	}
+	srand(42);
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		keys[i] = rand() % (BENCH_MAP_SIZE * 4);
+
+	bench_start();
+	ft::static_map<int, int>	m(table.begin(), table.end());
+	bench_stop("static_map build 1M sorted");
+
+	bench_start();
+	for (int round = 0;round < 4;round++)
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+			sum += m.find(keys[i]) != m.end();
+	bench_stop("static_map find 4M random");
+
+	bench_start();
+	for (int round = 0;round < 4;round++)
+		for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		{
+			ft::static_map<int, int>::const_iterator	it = m.lower_bound(keys[i]);
+
+			sum += it == m.end() ? 0 : it->second;
+		}
+	bench_stop("static_map lower_bound 4M random");
+
+	std::cout << "(" << sum << ")" << std::endl;
+	delete[] keys;
+#else
+	std::cout << "static_map build 1M sorted: n/a" << std::endl;
+	std::cout << "static_map find 4M random: n/a" << std::endl;
+	std::cout << "static_map lower_bound 4M random: n/a" << std::endl << "(n/a)" << std::endl;
+#endif
+}
+
+// Random keys in, hits and misses out, then everything erased again.
+template<class Map>
+void	bench_hash(const std::string& name)
+{
+	int		*keys = new int[BENCH_MAP_SIZE];
+	long	sum = 0;
+	Map		m;
+
+	srand(7);
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		keys[i] = rand() % (BENCH_MAP_SIZE * 4) * 2;
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		m[keys[i]] = i;
+	bench_stop((name + " insert 1M random").c_str());
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		sum += m.find(keys[i])->second;
+	bench_stop((name + " find 1M hits").c_str());
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		sum += m.count(keys[i] + 1);
+	bench_stop((name + " count 1M misses").c_str());
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		sum += m.erase(keys[i]);
+	bench_stop((name + " erase 1M").c_str());
+
+	std::cout << "(" << sum << ", " << m.size() << ")" << std::endl;
+	delete[] keys;
+}
+
+void	bench_unordered_map(void)
+{
+	bench_hash<TESTED_NAMESPACE::map<int, int> >("map");
+#if FT_VERSION == 1 || __cplusplus >= 201103L
+	bench_hash<TESTED_NAMESPACE::unordered_map<int, int> >("unordered_map");
+#else
+	std::cout << "unordered_map insert 1M random: n/a" << std::endl;
+	std::cout << "unordered_map find 1M hits: n/a" << std::endl;
+	std::cout << "unordered_map count 1M misses: n/a" << std::endl;
+	std::cout << "unordered_map erase 1M: n/a" << std::endl << "(n/a)" << std::endl;
+#endif
+}
+
+// Random keys drawn from a range half the count, so the multiset keeps
+// about two entries per key.
+template<class Set>
+void	bench_tree_set(const std::string& name)
+{
+	int		*keys = new int[BENCH_MAP_SIZE];
+	long	sum = 0;
+	Set		s;
+
+	srand(11);
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		keys[i] = rand() % (BENCH_MAP_SIZE / 2);
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		s.insert(keys[i]);
+	bench_stop((name + " insert 1M random").c_str());
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		sum += *s.lower_bound(keys[i]);
+	bench_stop((name + " lower_bound 1M hits").c_str());
+
+	bench_start();
+	for (int i = 0;i < BENCH_MAP_SIZE;i++)
+		sum += s.erase(keys[i]);
+	bench_stop((name + " erase 1M").c_str());
+
+	std::cout << "(" << sum << ", " << s.size() << ")" << std::endl;
+	delete[] keys;
+}
+
+void	bench_set(void)
+{
+	bench_tree_set<TESTED_NAMESPACE::set<int> >("set");
+	bench_tree_set<TESTED_NAMESPACE::multiset<int> >("multiset");
+}
+
+#define BENCH_VECTOR_SIZE	100000
+
+void	bench_vector_insert(void)
+{
+	TESTED_NAMESPACE::vector<int>	front;
+	TESTED_NAMESPACE::vector<int>	middle;
+	TESTED_NAMESPACE::vector<int>	back;
+
+	front.reserve(BENCH_VECTOR_SIZE);
+	middle.reserve(BENCH_VECTOR_SIZE);
+	back.reserve(BENCH_VECTOR_SIZE);
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE;i++)
+		front.insert(front.begin(), i);
+	bench_stop("vector insert 100k front");
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE;i++)
+		middle.insert(middle.begin() + middle.size() / 2, i);
+	bench_stop("vector insert 100k middle");
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 10;i++)
+		back.insert(back.end(), i);
+	bench_stop("vector insert 1M end");
+
+	bench_start();
+	for (int i = 0;i < 1000;i++)
+		middle.insert(middle.begin() + middle.size() / 2, 10, i);
+	bench_stop("vector insert 1000x10 fill middle");
+	std::cout << "(" << front[0] + middle[0] + back[0] << ")" << std::endl;
+}
+
+struct	sample
+{
+	double	value;
+	int		channel;
+	int		flags;
+};
+
+#if FT_VERSION == 1
+namespace ft
+{
+	template<>
+	struct is_trivially_copyable<sample> : public true_type {};
+}
+#endif
+
+void	bench_vector_pod(void)
+{
+	TESTED_NAMESPACE::vector<sample>	samples;
+	sample								s = { 1.0, 2, 3 };
+	long								sum = 0;
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 20;i++)
+		samples.push_back(s);
+	bench_stop("vector<pod> push_back 2M");
+
+	bench_start();
+	for (int i = 0;i < 20;i++)
+	{
+		TESTED_NAMESPACE::vector<sample>	copy(samples);
+
+		sum += copy.size();
+	}
+	bench_stop("vector<pod> copy construct 2M x20");
+
+	bench_start();
+	for (int i = 0;i < 200;i++)
+		samples.erase(samples.begin());
+	bench_stop("vector<pod> erase front x200");
+
+	bench_start();
+	for (int i = 0;i < 200;i++)
+		samples.insert(samples.begin() + 10, samples[0]);
+	bench_stop("vector<pod> insert front x200");
+	std::cout << "(" << sum << ")" << std::endl;
+}
+
+template<class Vector>
+void	bench_vector_growth(const char *name)
+{
+	Vector	v;
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 100;i++)
+		v.push_back(i);
+	bench_stop(name);
+	std::cout << "capacity: " << v.capacity() << ", unused: " << (v.capacity() - v.size()) * 100 / v.capacity() << "%" << std::endl;
+}
+
+void	bench_vector_growth(void)
+{
+	bench_vector_growth<TESTED_NAMESPACE::vector<int> >("vector push_back 10M default growth");
+#if FT_VERSION == 1
+	bench_vector_growth<ft::vector<int, std::allocator<int>, ft::golden_growth> >("vector push_back 10M golden_growth");
+	bench_vector_growth<ft::vector<int, std::allocator<int>, ft::size_class_growth<> > >("vector push_back 10M size_class_growth");
+#else
+	std::cout << "vector push_back 10M golden_growth: n/a" << std::endl << "capacity: n/a" << std::endl;
+	std::cout << "vector push_back 10M size_class_growth: n/a" << std::endl << "capacity: n/a" << std::endl;
+#endif
+}
+
+// Reallocation copies every string in C++98 and moves them since C++11:
+// build with `make bench CXXSTD=c++11` to compare.
+void	bench_vector_string(void)
+{
+	TESTED_NAMESPACE::vector<std::string>	records;
+	std::string								record(64, 'r');
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 10;i++)
+		records.push_back(record);
+	bench_stop("vector<string> push_back 1M");
+
+	bench_start();
+	for (int i = 0;i < 20;i++)
+		records.insert(records.begin() + i, record);
+	bench_stop("vector<string> insert front x20");
+	std::cout << "(" << records.size() << ")" << std::endl;
+}
+
+// Copy-assign between same-sized vectors: the destination buffer is big
+// enough, so nothing should be reallocated.
+void	bench_vector_assign(void)
+{
+	TESTED_NAMESPACE::vector<int>			src(BENCH_VECTOR_SIZE * 100, 1);
+	TESTED_NAMESPACE::vector<int>			dst(BENCH_VECTOR_SIZE * 100, 2);
+	TESTED_NAMESPACE::vector<std::string>	words(BENCH_VECTOR_SIZE * 10, "source");
+	TESTED_NAMESPACE::vector<std::string>	copy(BENCH_VECTOR_SIZE * 10, "destination");
+
+	bench_start();
+	for (int i = 0;i < 10;i++)
+	{
+		src[i] = i;
+		dst = src;
+	}
+	bench_stop("vector operator= 10M x10");
+
+	bench_start();
+	for (int i = 0;i < 10;i++)
+	{
+		words[i] = "changed";
+		copy = words;
+	}
+	bench_stop("vector<string> operator= 1M x10");
+	std::cout << "(" << dst[9] + copy.size() << ")" << std::endl;
+}
+
+bool	bench_is_odd(int n)
+{
+	return (n % 2 != 0);
+}
+
+// Filter pass over 20k elements: erasing matches one at a time versus
+// a single erase_if pass.
+void	bench_vector_filter(void)
+{
+	TESTED_NAMESPACE::vector<int>			loop;
+	TESTED_NAMESPACE::vector<std::string>	words;
+
+	for (int i = 0;i < BENCH_VECTOR_SIZE / 5;i++)
+	{
+		loop.push_back(i);
+		words.push_back(std::string(i % 40, 'w'));
+	}
+	TESTED_NAMESPACE::vector<int>			single(loop);
+	TESTED_NAMESPACE::vector<int>			unordered(loop);
+
+	bench_start();
+	for (TESTED_NAMESPACE::vector<int>::iterator it = loop.begin();it != loop.end();)
+		it = bench_is_odd(*it) ? loop.erase(it) : it + 1;
+	bench_stop("vector filter 20k erase loop");
+
+	bench_start();
+	for (TESTED_NAMESPACE::vector<std::string>::iterator it = words.begin();it != words.end();)
+		it = it->size() % 2 ? words.erase(it) : it + 1;
+	bench_stop("vector<string> filter 20k erase loop");
+#if FT_VERSION == 1
+	bench_start();
+	ft::erase_if(single, bench_is_odd);
+	bench_stop("vector filter 20k erase_if");
+
+	bench_start();
+	for (TESTED_NAMESPACE::vector<int>::iterator it = unordered.begin();it != unordered.end();)
+		it = bench_is_odd(*it) ? unordered.swap_and_pop(it) : it + 1;
+	bench_stop("vector filter 20k swap_and_pop");
+	if (single.size() != loop.size() || unordered.size() != loop.size())
+		std::cout << "filter mismatch" << std::endl;
+#else
+	std::cout << "vector filter 20k erase_if: n/a" << std::endl;
+	std::cout << "vector filter 20k swap_and_pop: n/a" << std::endl;
+#endif
+	std::cout << "(" << loop.size() + words.size() << ")" << std::endl;
+}
+
+template<class Vector>
+void	bench_short_lived(const char *name)
+{
+	long	sum = 0;
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 20;i++)
+	{
+		Vector	v;
+
+		for (int j = 0;j < 6;j++)
+			v.push_back(i + j);
+		sum += v[i % 6];
+	}
+	bench_stop(name);
+	std::cout << "(" << sum << ")" << std::endl;
+}
+
+template<class Stack>
+void	bench_short_lived_stack(const char *name)
+{
+	long	sum = 0;
+
+	bench_start();
+	for (int i = 0;i < BENCH_VECTOR_SIZE * 20;i++)
+	{
+		Stack	s;
+
+		for (int j = 0;j < 4;j++)
+			s.push(i - j);
+		s.pop();
+		sum += s.top();
+	}
+	bench_stop(name);
+	std::cout << "(" << sum << ")" << std::endl;
+}
+
+void	bench_small_vector(void)
+{
+	bench_short_lived<TESTED_NAMESPACE::vector<int> >("vector 2M short-lived x6");
+	bench_short_lived_stack<TESTED_NAMESPACE::stack<int> >("stack 2M short-lived x4");
+#if FT_VERSION == 1
+	bench_short_lived<ft::small_vector<int, 8> >("small_vector<8> 2M short-lived x6");
+	bench_short_lived_stack<ft::stack<int, ft::small_vector<int, 8> > >("stack<small_vector<8>> 2M short-lived x4");
+#else
+	std::cout << "small_vector<8> 2M short-lived x6: n/a" << std::endl << "(n/a)" << std::endl;
+	std::cout << "stack<small_vector<8>> 2M short-lived x4: n/a" << std::endl << "(n/a)" << std::endl;
+#endif
+}
+
+int main(int ac, char **av)
+{
+	if (ac == 2 && av[1][0])
+	{
+		switch (av[1][0])
+		{
+			case 'm':
+				bench_map();
+				bench_map_pool();
+				bench_map_memory();
+				bench_map_string();
+				bench_flat_map();
+				bench_static_map();
+				bench_unordered_map();
+				bench_set();
+				break;
+			case 'v':
+				bench_vector_insert();
+				bench_vector_pod();
+				bench_vector_growth();
+				bench_vector_string();
+				bench_small_vector();
+				bench_vector_filter();
+				bench_vector_assign();
+				break;
+			default:
+				bench_map();
+				bench_map_pool();
+				bench_map_memory();
+				bench_map_string();
+				bench_flat_map();
+				bench_static_map();
+				bench_unordered_map();
+				bench_set();
+				bench_vector_insert();
+				bench_vector_pod();
+				bench_vector_growth();
+				bench_vector_string();
+				bench_small_vector();
+				bench_vector_filter();
+				bench_vector_assign();
+				break;
+		}
+	}
+	return (0);
+}
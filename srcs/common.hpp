@@ -13,7 +13,14 @@
 #ifndef FT_CONTAINERS_COMMON_HPP
 # define FT_CONTAINERS_COMMON_HPP
 
+#include <cstring>
 #include "iterator.hpp"
+#include "type_traits.hpp"
+
+#if __cplusplus >= 201103L
+# include <iterator>
+# include <type_traits>
+#endif
 
 namespace ft
 {
@@ -25,14 +32,14 @@ namespace ft
 	}
 
 	template<class InputIt, class NoThrowForwardIt>
-	NoThrowForwardIt uninitialized_copy(InputIt first, InputIt last, NoThrowForwardIt d_first)
+	NoThrowForwardIt __uninitialized_copy_loop(InputIt first, InputIt last, NoThrowForwardIt d_first)
 	{
 		typedef typename ft::iterator_traits<NoThrowForwardIt>::value_type T;
 		NoThrowForwardIt current = d_first;
 		try {
 			for (; first != last; ++first, (void) ++current) {
 				::new (const_cast<void*>(static_cast<const volatile void*>(
-					addressof(*current)))) T(*first);
+					ft::addressof(*current)))) T(*first);
 			}
 			return current;
 		} catch (...) {
@@ -43,6 +50,116 @@ namespace ft
 		}
 	}
 	
+	template<class InputIt, class NoThrowForwardIt>
+	NoThrowForwardIt uninitialized_copy(InputIt first, InputIt last, NoThrowForwardIt d_first)
+	{
+		return (ft::__uninitialized_copy_loop(first, last, d_first));
+	}
+
+	template<class T>
+	T*	__uninitialized_copy_aux(const T* first, const T* last, T* d_first, true_type)
+	{
+		size_t n = last - first;
+
+		if (n != 0)
+			std::memmove(d_first, first, n * sizeof(T));
+		return (d_first + n);
+	}
+
+	template<class T>
+	T*	__uninitialized_copy_aux(const T* first, const T* last, T* d_first, false_type)
+	{
+		return (ft::__uninitialized_copy_loop(first, last, d_first));
+	}
+
+	// Contiguous ranges of trivially copyable types are copied with memmove.
+	template<class T>
+	T*	uninitialized_copy(const T* first, const T* last, T* d_first)
+	{
+		return (ft::__uninitialized_copy_aux(first, last, d_first, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class T>
+	T*	uninitialized_copy(T* first, T* last, T* d_first)
+	{
+		return (ft::uninitialized_copy(static_cast<const T*>(first), static_cast<const T*>(last), d_first));
+	}
+
+	template<class T, class Container>
+	T*	uninitialized_copy(normal_iterator<const T*, Container> first, normal_iterator<const T*, Container> last, T* d_first)
+	{
+		return (ft::uninitialized_copy(first.base(), last.base(), d_first));
+	}
+
+	template<class T, class Container>
+	T*	uninitialized_copy(normal_iterator<T*, Container> first, normal_iterator<T*, Container> last, T* d_first)
+	{
+		return (ft::uninitialized_copy(static_cast<const T*>(first.base()), static_cast<const T*>(last.base()), d_first));
+	}
+
+	template<class T>
+	T*	__uninitialized_move_aux(T* first, T* last, T* d_first, true_type)
+	{
+		return (ft::uninitialized_copy(first, last, d_first));
+	}
+
+#if __cplusplus >= 201103L
+	template<class T>
+	T*	__uninitialized_move_aux(T* first, T* last, T* d_first, std::true_type)
+	{
+		return (ft::__uninitialized_copy_loop(std::make_move_iterator(first), std::make_move_iterator(last), d_first));
+	}
+
+	template<class T>
+	T*	__uninitialized_move_aux(T* first, T* last, T* d_first, std::false_type)
+	{
+		return (ft::__uninitialized_copy_loop(first, last, d_first));
+	}
+
+	template<class T>
+	T*	__uninitialized_move_aux(T* first, T* last, T* d_first, false_type)
+	{
+		typedef std::integral_constant<bool, std::is_nothrow_move_constructible<T>::value
+			|| !std::is_copy_constructible<T>::value>	use_move;
+
+		return (ft::__uninitialized_move_aux(first, last, d_first, use_move()));
+	}
+#else
+	template<class T>
+	T*	__uninitialized_move_aux(T* first, T* last, T* d_first, false_type)
+	{
+		return (ft::__uninitialized_copy_loop(first, last, d_first));
+	}
+#endif
+
+	// Relocates [first, last) into raw storage for a reallocation. Since
+	// C++11 elements are moved when their move constructor cannot throw,
+	// so a failure never leaves the source half moved. C++98 copies.
+	template<class T>
+	T*	uninitialized_move_if_noexcept(T* first, T* last, T* d_first)
+	{
+		return (ft::__uninitialized_move_aux(first, last, d_first, typename is_trivially_copyable<T>::type()));
+	}
+
+	template<class ForwardIt, class Size, class T>
+	ForwardIt uninitialized_fill_n(ForwardIt first, Size count, const T& value)
+	{
+		typedef typename ft::iterator_traits<ForwardIt>::value_type V;
+		ForwardIt current = first;
+		try {
+			for (; count > 0; ++current, (void) --count) {
+				::new (const_cast<void*>(static_cast<const volatile void*>(
+					ft::addressof(*current)))) V(value);
+			}
+			return current;
+		} catch (...) {
+			for (; first != current; ++first) {
+				first->~V();
+			}
+			throw;
+		}
+	}
+	
 	template<typename T>
 	void	swap(T *a, T *b)
 	{
@@ -71,6 +188,12 @@ namespace ft
      	 typedef Result	result_type;  
     };
 
+	// Tag for constructors whose input is already sorted with no
+	// duplicate keys, letting them skip the comparisons.
+	struct sorted_unique_t {};
+
+	static const sorted_unique_t sorted_unique = sorted_unique_t();
+
 	template<typename T>
     struct less : public binary_function<T, T, bool>
     {
@@ -79,6 +202,35 @@ namespace ft
 			return x < y;
 		}
     };
+
+	template<typename T>
+    struct equal_to : public binary_function<T, T, bool>
+    {
+      	bool operator()(const T& x, const T& y) const
+     	{
+			return x == y;
+		}
+    };
+
+	// Key extractors for the search tree: a set's value is its own key,
+	// a map's key is the first member of its pair.
+	template<typename T>
+    struct identity : public unary_function<T, T>
+    {
+      	const T& operator()(const T& x) const
+     	{
+			return x;
+		}
+    };
+
+	template<typename Pair>
+    struct select_first : public unary_function<Pair, typename Pair::first_type>
+    {
+      	const typename Pair::first_type& operator()(const Pair& x) const
+     	{
+			return x.first;
+		}
+    };
 };
 
 
@@ -0,0 +1,549 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/18 10:12:44 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/18 10:12:44 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_FLAT_MAP_HPP
+# define FT_FLAT_MAP_HPP
+
+#include <memory>
+#include <stdexcept>
+#include "common.hpp"
+#include "iterator.hpp"
+#include "algorithm.hpp"
+#include "pair.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+
+	// Same interface as ft::map, but the entries live sorted in a single
+	// ft::vector and lookups are binary searches over contiguous memory.
+	// Inserting or erasing shifts the tail and invalidates iterators, so
+	// it is meant for tables built once (ideally through the sorted range
+	// insert) and queried many times.
+	template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class flat_map
+	{
+		public:
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef ft::pair<Key, T>												value_type;
+			typedef size_t															size_type;
+			typedef ptrdiff_t														difference_type;
+			typedef Compare															key_compare;
+			typedef typename Allocator::template rebind<value_type>::other			allocator_type;
+			typedef ft::vector<value_type, allocator_type>							container_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef typename container_type::iterator								iterator;
+			typedef typename container_type::const_iterator							const_iterator;
+			typedef typename container_type::reverse_iterator						reverse_iterator;
+			typedef typename container_type::const_reverse_iterator					const_reverse_iterator;
+		public:
+			class value_compare : ft::binary_function<value_type, value_type, bool>
+			{
+				friend class flat_map<Key, T, Compare, Allocator>;
+				protected:
+					Compare comp;
+
+					value_compare(Compare _comp) : comp(_comp) {}
+				public:
+					bool operator()(const value_type& x, const value_type& y) const
+					{
+						return (comp(x.first, y.first));
+					}
+			};
+		public:
+			// MEMBERS FUNCTIONS
+			flat_map() : entries(), comp() {}
+
+			explicit flat_map(const Compare& comp, const Allocator& alloc = Allocator()) : entries(allocator_type(alloc)), comp(comp) {}
+
+			template<class InputIt>
+			flat_map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : entries(allocator_type(alloc)), comp(comp)
+			{
+				this->insert(first, last);
+			}
+
+			template<class InputIt>
+			flat_map(ft::sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : entries(allocator_type(alloc)), comp(comp)
+			{
+				this->entries.assign(first, last);
+			}
+
+			flat_map(const flat_map& other) : entries(other.entries), comp(other.comp) {}
+
+			~flat_map() {}
+
+			allocator_type	get_allocator() const
+			{
+				return (this->entries.get_allocator_type());
+			}
+
+			flat_map&	operator=(const flat_map& other)
+			{
+				if (this != &other)
+				{
+					this->entries = other.entries;
+					this->comp = other.comp;
+				}
+				return (*this);
+			}
+
+			// ELEMENT ACCESS
+			T&			at(const key_type& key)
+			{
+				iterator	it = this->find(key);
+
+				if (it == this->end())
+					throw std::out_of_range("flat_map::at");
+				return (it->second);
+			}
+
+			const T&	at(const key_type& key) const
+			{
+				const_iterator	it = this->find(key);
+
+				if (it == this->end())
+					throw std::out_of_range("flat_map::at");
+				return (it->second);
+			}
+
+			T&			operator[](const key_type& key)
+			{
+				iterator	it = this->lower_bound(key);
+
+				if (it == this->end() || this->comp(key, it->first))
+					it = this->entries.insert(it, value_type(key, T()));
+				return (it->second);
+			}
+
+			// CAPACITY
+			size_type	size() const
+			{
+				return (this->entries.size());
+			}
+
+			bool		empty() const
+			{
+				return (this->entries.empty());
+			}
+
+			size_type	max_size() const
+			{
+				return (this->entries.max_size());
+			}
+
+			size_type	capacity() const
+			{
+				return (this->entries.capacity());
+			}
+
+			void		reserve(size_type count)
+			{
+				this->entries.reserve(count);
+			}
+
+			void		shrink_to_fit()
+			{
+				this->entries.shrink_to_fit();
+			}
+
+			// ITERATORS
+			iterator 				begin()
+			{
+				return (this->entries.begin());
+			}
+
+			const_iterator			begin() const
+			{
+				return (this->entries.begin());
+			}
+
+			iterator 				end()
+			{
+				return (this->entries.end());
+			}
+
+			const_iterator			end() const
+			{
+				return (this->entries.end());
+			}
+
+			reverse_iterator		rend()
+			{
+				return (this->entries.rend());
+			}
+
+			const_reverse_iterator 	rend() const
+			{
+				return (this->entries.rend());
+			}
+
+			reverse_iterator 		rbegin()
+			{
+				return (this->entries.rbegin());
+			}
+
+			const_reverse_iterator 	rbegin() const
+			{
+				return (this->entries.rbegin());
+			}
+
+			// MODIFIERS
+			void						clear()
+			{
+				this->entries.clear();
+			}
+
+			ft::pair<iterator, bool>	insert(const value_type& value)
+			{
+				iterator	it = this->lower_bound(value.first);
+
+				if (it != this->end() && !this->comp(value.first, it->first))
+					return (ft::make_pair<iterator, bool>(it, false));
+				return (ft::make_pair<iterator, bool>(this->entries.insert(it, value), true));
+			}
+
+			// A hint right after value's slot skips the search.
+			iterator					insert(iterator hint, const value_type& value)
+			{
+				if ((hint == this->end() || this->comp(value.first, hint->first))
+					&& (hint == this->begin() || this->comp((hint - 1)->first, value.first)))
+					return (this->entries.insert(hint, value));
+				return (this->insert(value).first);
+			}
+
+			// A sorted forward range is merged in O(size() + count); anything
+			// else is sorted first, in O(count log count).
+			template<class InputIt>
+			void						insert(InputIt first, InputIt last)
+			{
+				this->insert_range(first, last, ft::iterator_category(first));
+			}
+
+			// Same as insert(first, last), but the caller guarantees the input
+			// is sorted and unique.
+			template<class ForwardIt>
+			void						insert(ft::sorted_unique_t, ForwardIt first, ForwardIt last)
+			{
+				if (this->empty())
+					this->entries.assign(first, last);
+				else
+					this->merge_sorted(first, last);
+			}
+
+			iterator					erase(iterator pos)
+			{
+				return (this->entries.erase(pos));
+			}
+
+			iterator					erase(iterator first, iterator last)
+			{
+				return (this->entries.erase(first, last));
+			}
+
+			size_type					erase(const key_type& key)
+			{
+				iterator	it = this->find(key);
+
+				if (it == this->end())
+					return (0);
+				this->entries.erase(it);
+				return (1);
+			}
+
+			void						swap(flat_map& other)
+			{
+				this->entries.swap(other.entries);
+				ft::swap(&this->comp, &other.comp);
+			}
+
+			// LOOKUP
+			size_type								count(const key_type& key) const
+			{
+				return (this->find(key) != this->end() ? 1 : 0);
+			}
+
+			iterator								find(const key_type& key)
+			{
+				size_type	i = this->lower_index(key);
+
+				if (i != this->size() && !this->comp(key, this->entries[i].first))
+					return (this->begin() + i);
+				return (this->end());
+			}
+
+			const_iterator							find(const key_type& key) const
+			{
+				size_type	i = this->lower_index(key);
+
+				if (i != this->size() && !this->comp(key, this->entries[i].first))
+					return (this->begin() + i);
+				return (this->end());
+			}
+
+			iterator								lower_bound(const key_type& key)
+			{
+				return (this->begin() + this->lower_index(key));
+			}
+
+			const_iterator							lower_bound(const key_type& key) const
+			{
+				return (this->begin() + this->lower_index(key));
+			}
+
+			iterator								upper_bound(const key_type& key)
+			{
+				return (this->begin() + this->upper_index(key));
+			}
+
+			const_iterator							upper_bound(const key_type& key) const
+			{
+				return (this->begin() + this->upper_index(key));
+			}
+
+			ft::pair<iterator,iterator>				equal_range(const key_type& key)
+			{
+				return (ft::make_pair<iterator, iterator>(this->lower_bound(key), this->upper_bound(key)));
+			}
+
+			ft::pair<const_iterator,const_iterator>	equal_range(const key_type& key) const
+			{
+				return (ft::make_pair<const_iterator, const_iterator>(this->lower_bound(key), this->upper_bound(key)));
+			}
+
+			// OBSERVERS
+			key_compare key_comp() const
+			{
+				return (this->comp);
+			}
+
+			flat_map::value_compare value_comp() const
+			{
+				return (flat_map::value_compare(this->comp));
+			}
+		private:
+			container_type	entries;
+			key_compare		comp;
+
+			// Halving search without an early exit: one comparison per step.
+			size_type	lower_index(const key_type& key) const
+			{
+				size_type	first = 0;
+				size_type	count = this->entries.size();
+
+				while (count > 0)
+				{
+					size_type	half = count / 2;
+
+					if (this->comp(this->entries[first + half].first, key))
+					{
+						first += half + 1;
+						count -= half + 1;
+					}
+					else
+						count = half;
+				}
+				return (first);
+			}
+
+			size_type	upper_index(const key_type& key) const
+			{
+				size_type	first = 0;
+				size_type	count = this->entries.size();
+
+				while (count > 0)
+				{
+					size_type	half = count / 2;
+
+					if (!this->comp(key, this->entries[first + half].first))
+					{
+						first += half + 1;
+						count -= half + 1;
+					}
+					else
+						count = half;
+				}
+				return (first);
+			}
+
+			// Unsorted input is buffered, sorted, then merged: O(n log n)
+			// instead of one tail shift per element.
+			template<class InputIt>
+			void	insert_range(InputIt first, InputIt last, ft::input_iterator_tag)
+			{
+				container_type	buffer;
+
+				for (;first != last;++first)
+					buffer.push_back(*first);
+				this->insert_unsorted(buffer);
+			}
+
+			template<class ForwardIt>
+			void	insert_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+			{
+				if (this->is_sorted(first, last))
+					this->merge_sorted(first, last);
+				else
+				{
+					container_type	buffer(first, last);
+
+					this->insert_unsorted(buffer);
+				}
+			}
+
+			// The sort is stable, so of equal keys the first one read reaches
+			// merge_sorted first and wins, as with repeated inserts.
+			void	insert_unsorted(container_type& buffer)
+			{
+				this->stable_sort(buffer);
+				this->merge_sorted(buffer.begin(), buffer.end());
+			}
+
+			// Bottom-up merge sort on the keys, bouncing between entries and
+			// a scratch copy of them.
+			void	stable_sort(container_type& entries) const
+			{
+				size_type		n = entries.size();
+
+				if (n < 2)
+					return ;
+
+				container_type	scratch(entries);
+				container_type*	from = &entries;
+				container_type*	to = &scratch;
+
+				for (size_type width = 1;width < n;width *= 2)
+				{
+					for (size_type low = 0;low < n;low += 2 * width)
+					{
+						size_type	mid = low + width < n ? low + width : n;
+						size_type	high = mid + width < n ? mid + width : n;
+						size_type	i = low;
+						size_type	j = mid;
+						size_type	k = low;
+
+						while (i < mid && j < high)
+						{
+							if (this->comp((*from)[j].first, (*from)[i].first))
+								ft::__move_assign((*to)[k++], (*from)[j++]);
+							else
+								ft::__move_assign((*to)[k++], (*from)[i++]);
+						}
+						while (i < mid)
+							ft::__move_assign((*to)[k++], (*from)[i++]);
+						while (j < high)
+							ft::__move_assign((*to)[k++], (*from)[j++]);
+					}
+					ft::swap(&from, &to);
+				}
+				if (from != &entries)
+					entries.swap(scratch);
+			}
+
+			template<class ForwardIt>
+			bool	is_sorted(ForwardIt first, ForwardIt last) const
+			{
+				if (first == last)
+					return (true);
+				for (ForwardIt prev = first;++first != last;prev = first)
+					if (this->comp((*first).first, (*prev).first))
+						return (false);
+				return (true);
+			}
+
+			// The keys we do not hold yet are gathered in one pass alongside
+			// ours (the first of equal keys wins, as with repeated inserts),
+			// appended, then merged into place from the back.
+			template<class ForwardIt>
+			void	merge_sorted(ForwardIt first, ForwardIt last)
+			{
+				container_type	fresh;
+				iterator		pos = this->begin();
+
+				for (;first != last;++first)
+				{
+					const key_type&	key = (*first).first;
+
+					while (pos != this->end() && this->comp(pos->first, key))
+						++pos;
+					if ((pos == this->end() || this->comp(key, pos->first))
+						&& (fresh.empty() || this->comp(fresh.back().first, key)))
+						fresh.push_back(*first);
+				}
+				if (fresh.empty())
+					return ;
+
+				size_type	old_size = this->size();
+
+				this->entries.insert(this->end(), fresh.begin(), fresh.end());
+
+				iterator	out = this->end();
+				iterator	ours = this->begin() + old_size;
+				iterator	theirs = fresh.end();
+
+				while (theirs != fresh.begin())
+				{
+					if (ours != this->begin() && this->comp((theirs - 1)->first, (ours - 1)->first))
+						ft::__move_assign(*--out, *--ours);
+					else
+						ft::__move_assign(*--out, *--theirs);
+				}
+			}
+	};
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator==(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator<(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator!=(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator>(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator<=(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator>=(const ft::flat_map<Key, T, Compare, Allocator>& lhs, const ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	void swap(ft::flat_map<Key, T, Compare, Allocator>& lhs, ft::flat_map<Key, T, Compare, Allocator>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+};
+
+#endif
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   growth_policy.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/12 09:41:07 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/12 09:41:07 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_GROWTH_POLICY_HPP
+# define FT_GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+	// A growth policy picks the capacity a vector reallocates to when it
+	// holds size elements and needs room for required ones (required >
+	// size). The result must be at least required.
+	//
+	// trim(count, capacity) tells assign whether to give back a buffer
+	// that is much larger than the count elements it now holds. Policies
+	// inherit the default below, which keeps it as std::vector does.
+
+	struct keep_capacity
+	{
+		static bool		trim(size_t, size_t)
+		{
+			return (false);
+		}
+	};
+
+	struct double_growth : keep_capacity
+	{
+		static size_t	next_capacity(size_t size, size_t required, size_t)
+		{
+			return (required < size * 2 ? size * 2 : required);
+		}
+	};
+
+	struct golden_growth : keep_capacity
+	{
+		static size_t	next_capacity(size_t size, size_t required, size_t)
+		{
+			size_t grown = size + size / 2;
+
+			return (required < grown ? grown : required);
+		}
+	};
+
+	// Grows by 1.5x, then rounds the byte size up to what malloc really
+	// hands out: powers of two below a page, whole pages above it.
+	template<size_t PageSize = 4096>
+	struct size_class_growth : keep_capacity
+	{
+		static size_t	next_capacity(size_t size, size_t required, size_t elem_size)
+		{
+			size_t count = golden_growth::next_capacity(size, required, elem_size);
+			size_t bytes = count * elem_size;
+			size_t rounded = 16;
+
+			if (bytes >= PageSize)
+				rounded = (bytes + PageSize - 1) / PageSize * PageSize;
+			else
+				while (rounded < bytes)
+					rounded *= 2;
+			return (rounded / elem_size < count ? count : rounded / elem_size);
+		}
+	};
+
+	// Growth reallocates as Growth does, but assign reallocates to fit
+	// when the new contents would use less than 1/Ratio of the buffer.
+	template<class Growth = double_growth, size_t Ratio = 4>
+	struct trim_on_assign : Growth
+	{
+		static bool		trim(size_t count, size_t capacity)
+		{
+			return (count * Ratio < capacity);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/21 11:26:50 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/21 11:26:50 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_HASH_HPP
+# define FT_HASH_HPP
+
+#include <cstddef>
+#include <string>
+#include "common.hpp"
+
+namespace ft
+{
+	// Hash functors for ft::unordered_map. Integers and pointers hash to
+	// their own value: the table scrambles the bits itself.
+	template<class T>
+	struct hash;
+
+	template<class T>
+	struct __integral_hash : public unary_function<T, size_t>
+	{
+		size_t	operator()(T value) const
+		{
+			return (static_cast<size_t>(value));
+		}
+	};
+
+	template<> struct hash<bool> : public __integral_hash<bool> {};
+	template<> struct hash<char> : public __integral_hash<char> {};
+	template<> struct hash<signed char> : public __integral_hash<signed char> {};
+	template<> struct hash<unsigned char> : public __integral_hash<unsigned char> {};
+	template<> struct hash<wchar_t> : public __integral_hash<wchar_t> {};
+	template<> struct hash<short> : public __integral_hash<short> {};
+	template<> struct hash<unsigned short> : public __integral_hash<unsigned short> {};
+	template<> struct hash<int> : public __integral_hash<int> {};
+	template<> struct hash<unsigned int> : public __integral_hash<unsigned int> {};
+	template<> struct hash<long> : public __integral_hash<long> {};
+	template<> struct hash<unsigned long> : public __integral_hash<unsigned long> {};
+	template<> struct hash<long long> : public __integral_hash<long long> {};
+	template<> struct hash<unsigned long long> : public __integral_hash<unsigned long long> {};
+
+	template<class T>
+	struct hash<T*> : public unary_function<T*, size_t>
+	{
+		size_t	operator()(T* p) const
+		{
+			return (reinterpret_cast<size_t>(p));
+		}
+	};
+
+	// FNV-1a over the bytes.
+	template<>
+	struct hash<std::string> : public unary_function<std::string, size_t>
+	{
+		size_t	operator()(const std::string& s) const
+		{
+			size_t	h = 2166136261UL;
+
+			for (std::string::size_type i = 0;i < s.size();i++)
+				h = (h ^ static_cast<unsigned char>(s[i])) * 16777619UL;
+			return (h);
+		}
+	};
+}
+
+#endif
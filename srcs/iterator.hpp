@@ -14,6 +14,7 @@
 # define FT_ITERATOR_HPP
 
 #include <cstddef>
+#include <iterator>
 #include "type_traits.hpp"
 #include <iostream>
 
@@ -66,6 +67,83 @@ namespace ft
 		typedef const T&					reference;
 	};
 
+	template<typename Category>
+	struct __category_helper { typedef Category type; };
+
+	template<>
+	struct __category_helper<std::input_iterator_tag> { typedef input_iterator_tag type; };
+
+	template<>
+	struct __category_helper<std::output_iterator_tag> { typedef output_iterator_tag type; };
+
+	template<>
+	struct __category_helper<std::forward_iterator_tag> { typedef forward_iterator_tag type; };
+
+	template<>
+	struct __category_helper<std::bidirectional_iterator_tag> { typedef bidirectional_iterator_tag type; };
+
+	template<>
+	struct __category_helper<std::random_access_iterator_tag> { typedef random_access_iterator_tag type; };
+
+	// Category of Iter as an ft tag, so std iterators dispatch like ours.
+	template<typename Iter>
+	inline typename __category_helper<typename iterator_traits<Iter>::iterator_category>::type	iterator_category(const Iter&)
+	{
+		return (typename __category_helper<typename iterator_traits<Iter>::iterator_category>::type());
+	}
+
+	template<typename InputIt>
+	inline typename iterator_traits<InputIt>::difference_type	__distance(InputIt first, InputIt last, input_iterator_tag)
+	{
+		typename iterator_traits<InputIt>::difference_type n = 0;
+
+		for (;first != last;++first)
+			++n;
+		return (n);
+	}
+
+	template<typename RandomIt>
+	inline typename iterator_traits<RandomIt>::difference_type	__distance(RandomIt first, RandomIt last, random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	// Walks the range, unless it is random access. A pure input range
+	// can only be traversed once, so do not count it before reading it.
+	template<typename InputIt>
+	inline typename iterator_traits<InputIt>::difference_type	distance(InputIt first, InputIt last)
+	{
+		return (ft::__distance(first, last, ft::iterator_category(first)));
+	}
+
+	template<typename InputIt, typename Distance>
+	inline void	__advance(InputIt& it, Distance n, input_iterator_tag)
+	{
+		for (;n > 0;--n)
+			++it;
+	}
+
+	template<typename BidirIt, typename Distance>
+	inline void	__advance(BidirIt& it, Distance n, bidirectional_iterator_tag)
+	{
+		for (;n > 0;--n)
+			++it;
+		for (;n < 0;++n)
+			--it;
+	}
+
+	template<typename RandomIt, typename Distance>
+	inline void	__advance(RandomIt& it, Distance n, random_access_iterator_tag)
+	{
+		it += n;
+	}
+
+	template<typename InputIt, typename Distance>
+	inline void	advance(InputIt& it, Distance n)
+	{
+		ft::__advance(it, n, ft::iterator_category(it));
+	}
+
 	template<typename Iterator>
 	class reverse_iterator : public iterator<typename iterator_traits<Iterator>::iterator_category,
 											 typename iterator_traits<Iterator>::value_type,
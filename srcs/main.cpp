@@ -12,21 +12,464 @@
 
 #include <iostream>
 #include <exception>
+#include <stdexcept>
+#include <cstdlib>
+#include <cctype>
+#include <sstream>
+#include <iterator>
+#if __cplusplus >= 201103L
+# include <memory>
+# include <utility>
+#endif
 
 #ifndef FT_VERSION
 # define FT_VERSION 1
 #endif
 
+#include "pool_allocator.hpp"
+
 #if FT_VERSION == 1
 	#define TESTED_NAMESPACE ft
 	#include "map.hpp"
 	#include "vector.hpp"
 	#include "stack.hpp"
+	#include "small_vector.hpp"
+	#include "flat_map.hpp"
+	#include "static_map.hpp"
+	#include "unordered_map.hpp"
+	#include "set.hpp"
+	#define SMALL_VECTOR(T, N) ft::small_vector<T, N>
+	#define FLAT_MAP(K, V) ft::flat_map<K, V>
+	#define STATIC_MAP(K, V) ft::static_map<K, V>
+	#define UNORDERED_MAP(K, V) ft::unordered_map<K, V>
+	#define COMPACT_MAP(K, V) ft::map<K, V, ft::less<K>, std::allocator<ft::pair<const K, V> >, ft::compact_node_base>
 #else
 	#define TESTED_NAMESPACE std
 	#include <map>
+	#include <set>
 	#include <vector>
 	#include <stack>
+	#include <algorithm>
+	#define SMALL_VECTOR(T, N) std::vector<T>
+	#define FLAT_MAP(K, V) std::map<K, V>
+	#define STATIC_MAP(K, V) std::map<K, V>
+	#define UNORDERED_MAP(K, V) std::map<K, V>
+	#define COMPACT_MAP(K, V) std::map<K, V>
+#endif
+
+template<class Vector>
+void	print_vector(const Vector& v)
+{
+	std::cout << "size: " << v.size() << ", capacity: " << v.capacity() << std::endl;
+	for (typename Vector::const_iterator it = v.begin();it != v.end();++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+}
+
+// Capacities differ by design between ft::small_vector and std::vector.
+template<class Vector>
+void	print_elements(const Vector& v)
+{
+	std::cout << "size: " << v.size() << std::endl;
+	for (typename Vector::const_iterator it = v.begin();it != v.end();++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+}
+
+void	test_vector_insert(void)
+{
+	TESTED_NAMESPACE::vector<std::string>	words;
+	TESTED_NAMESPACE::vector<std::string>	more;
+
+	// INSERT IN PLACE
+	words.reserve(64);
+	words.insert(words.end(), "end");
+	words.insert(words.begin(), "front");
+	words.insert(words.begin() + 1, "middle");
+	words.insert(words.begin() + 1, words.back());
+	print_vector(words);
+	words.insert(words.begin() + 1, 2, "fill-short");
+	words.insert(words.end() - 1, 5, "fill-long");
+	print_vector(words);
+	more.push_back("a");
+	more.push_back("b");
+	more.push_back("c");
+	words.insert(words.begin() + 2, more.begin(), more.end());
+	words.insert(words.end() - 1, more.begin(), more.end());
+	words.insert(words.end(), more.begin(), more.end());
+	print_vector(words);
+	words.insert(words.begin() + 3, 40, "grow");
+	print_vector(words);
+	words.insert(words.begin() + 1, more.begin(), more.end());
+	words.insert(words.begin(), 10, "realloc");
+	print_vector(words);
+}
+
+void	test_vector_trivial(void)
+{
+	TESTED_NAMESPACE::vector<double>		reals;
+	TESTED_NAMESPACE::vector<unsigned int>	counts(5u, 3u);
+	TESTED_NAMESPACE::vector<char *>		pointers(4, (char *)NULL);
+
+	for (int i = 0;i < 100;i++)
+		reals.push_back(i / 4.0);
+	reals.erase(reals.begin() + 10, reals.begin() + 60);
+	reals.erase(reals.begin());
+	reals.insert(reals.begin() + 5, 3, -1.5);
+	TESTED_NAMESPACE::vector<double>		reals_copy(reals);
+
+	reals.insert(reals.begin() + 2, reals_copy.begin() + 20, reals_copy.end());
+
+	reals_copy.assign(reals.begin() + 3, reals.begin() + 9);
+	reals.resize(30);
+	print_vector(reals);
+	print_vector(reals_copy);
+	counts.insert(counts.end(), 2u, 7u);
+	counts.assign(3u, 9u);
+	print_vector(counts);
+	std::cout << "size: " << pointers.size() << ", " << (pointers[3] == NULL) << std::endl;
+}
+
+void	test_vector_stream(void)
+{
+	std::istringstream							numbers("4 8 15 16 23 42");
+	std::istringstream							more("1 2 3 4 5 6 7 8 9 10 11 12 13");
+	std::istringstream							middle("-1 -2 -3");
+	std::istringstream							tail("100 200");
+	std::istream_iterator<int>					eof;
+
+	// RANGES READ ONCE
+	TESTED_NAMESPACE::vector<int>				streamed((std::istream_iterator<int>(numbers)), eof);
+
+	print_vector(streamed);
+	streamed.insert(streamed.begin() + 2, std::istream_iterator<int>(middle), eof);
+	for (TESTED_NAMESPACE::vector<int>::iterator it = streamed.begin();it != streamed.end();++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+	streamed.insert(streamed.end(), std::istream_iterator<int>(tail), eof);
+	print_vector(streamed);
+	streamed.assign(std::istream_iterator<int>(more), eof);
+	print_vector(streamed);
+	streamed.assign(std::istream_iterator<int>(numbers), eof);
+	print_vector(streamed);
+}
+
+// std::vector has neither swap_and_pop nor, before C++20, erase_if.
+template<class Vector, class Pred>
+size_t	vector_erase_if(Vector& v, Pred pred)
+{
+#if FT_VERSION == 1
+	return (ft::erase_if(v, pred));
+#else
+	typename Vector::iterator	last = std::remove_if(v.begin(), v.end(), pred);
+	size_t						count = v.end() - last;
+
+	v.erase(last, v.end());
+	return (count);
+#endif
+}
+
+template<class Vector>
+typename Vector::iterator	vector_swap_and_pop(Vector& v, typename Vector::iterator pos)
+{
+#if FT_VERSION == 1
+	return (v.swap_and_pop(pos));
+#else
+	size_t	index = pos - v.begin();
+
+	if (index != v.size() - 1)
+		*pos = v.back();
+	v.pop_back();
+	return (v.begin() + index);
+#endif
+}
+
+// shrink_to_fit is C++11; the swap trick does the same in C++98.
+template<class Vector>
+void	vector_shrink_to_fit(Vector& v)
+{
+#if FT_VERSION == 1
+	v.shrink_to_fit();
+#else
+	Vector(v).swap(v);
+#endif
+}
+
+// std::map has no hash policy; like std::unordered_map, the std build
+// throws length_error for a bucket count past max_size().
+template<class Map>
+void	unordered_map_rehash(Map& m, size_t count)
+{
+#if FT_VERSION == 1
+	m.rehash(count);
+#else
+	if (count > m.max_size())
+		throw std::length_error("rehash");
+#endif
+}
+
+template<class Map>
+void	unordered_map_reserve(Map& m, size_t count)
+{
+#if FT_VERSION == 1
+	m.reserve(count);
+#else
+	if (count > m.max_size())
+		throw std::length_error("reserve");
+#endif
+}
+
+void	test_vector_capacity(void)
+{
+	TESTED_NAMESPACE::vector<std::string>	big(1000, "peak");
+	TESTED_NAMESPACE::vector<std::string>	words(5, "word");
+	TESTED_NAMESPACE::vector<int>			a(3, 1);
+	TESTED_NAMESPACE::vector<int>			b;
+
+	// ASSIGN KEEPS THE BUFFER
+	big.assign(3, "small");
+	print_vector(big);
+	big.assign(words.begin(), words.begin() + 2);
+	print_vector(big);
+	big.assign(words.begin(), words.end());
+	print_vector(big);
+	big.assign(0, "none");
+	print_vector(big);
+
+	// SHRINK_TO_FIT
+	big.assign(10, "ten");
+	vector_shrink_to_fit(big);
+	print_vector(big);
+	big.clear();
+	vector_shrink_to_fit(big);
+	print_vector(big);
+	big.push_back("again");
+	print_vector(big);
+
+	// COPY ASSIGN REUSES THE BUFFER
+	TESTED_NAMESPACE::vector<std::string>&	alias = big;
+
+	big.reserve(100);
+	big = words;
+	print_vector(big);
+	big = alias;
+	print_vector(big);
+	words = TESTED_NAMESPACE::vector<std::string>(200, "large");
+	words = big;
+	print_vector(words);
+
+	// SWAP EQUAL CONTENTS
+	b.reserve(50);
+	b.assign(3, 1);
+	a.swap(b);
+	std::cout << a.capacity() << " " << b.capacity() << " " << (a == b) << std::endl;
+}
+
+// Copying a thrower throws once copies_left runs out.
+static int	copies_left = -1;
+
+struct	thrower
+{
+	int	value;
+
+	thrower(int v = 0) : value(v) {}
+
+	thrower(const thrower& other) : value(other.value)
+	{
+		if (copies_left == 0)
+			throw std::runtime_error("copy failed");
+		if (copies_left > 0)
+			copies_left--;
+	}
+
+	thrower&	operator=(const thrower& other)
+	{
+		this->value = other.value;
+		return (*this);
+	}
+};
+
+std::ostream&	operator<<(std::ostream& os, const thrower& t)
+{
+	return (os << t.value);
+}
+
+void	test_vector_exceptions(void)
+{
+	TESTED_NAMESPACE::vector<thrower>	v;
+	thrower								more[3] = { thrower(-1), thrower(-2), thrower(-3) };
+
+	for (int i = 0;i < 4;i++)
+		v.push_back(thrower(i));
+	print_vector(v);
+
+	// A FAILED REALLOCATION LEAVES THE VECTOR AS IT WAS
+	// Throwing while the new elements are built...
+	copies_left = 0;
+	try { v.push_back(thrower(4)); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = 1;
+	try { v.insert(v.begin() + 1, 3, thrower(9)); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = 2;
+	try { v.insert(v.begin() + 3, more, more + 3); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	// ...or while the old ones are relocated
+	copies_left = 2;
+	try { v.push_back(thrower(4)); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = 3;
+	try { v.insert(v.begin() + 1, 3, thrower(9)); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = 4;
+	try { v.insert(v.begin() + 2, more, more + 3); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = 1;
+	try { v.reserve(100); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	print_vector(v);
+	copies_left = -1;
+	v.insert(v.begin() + 2, more, more + 3);
+	print_vector(v);
+}
+
+bool	is_odd(int n)
+{
+	return (n % 2 != 0);
+}
+
+bool	is_short(const std::string& s)
+{
+	return (s.size() < 3);
+}
+
+void	test_vector_bulk_erase(void)
+{
+	TESTED_NAMESPACE::vector<int>			numbers;
+	TESTED_NAMESPACE::vector<std::string>	words;
+	SMALL_VECTOR(std::string, 4)			small;
+
+	for (int i = 0;i < 50;i++)
+		numbers.push_back(i * 7 % 23);
+	std::cout << "erased: " << vector_erase_if(numbers, is_odd) << std::endl;
+	print_vector(numbers);
+	std::cout << "erased: " << vector_erase_if(numbers, is_odd) << std::endl;
+	for (int i = 0;i < 12;i++)
+		words.push_back(std::string(i % 5, 'a' + i));
+	small.assign(words.begin(), words.end());
+	std::cout << "erased: " << vector_erase_if(words, is_short) << std::endl;
+	print_vector(words);
+	std::cout << "erased: " << vector_erase_if(small, is_short) << std::endl;
+	print_elements(small);
+
+	// UNORDERED ERASE
+	std::cout << *vector_swap_and_pop(numbers, numbers.begin() + 2) << std::endl;
+	vector_swap_and_pop(numbers, numbers.end() - 1);
+	vector_swap_and_pop(words, words.begin());
+	vector_swap_and_pop(small, small.begin() + 1);
+	print_vector(numbers);
+	print_vector(words);
+	print_elements(small);
+	words.erase(words.begin() + 1);
+	words.erase(words.begin(), words.begin() + 2);
+	print_vector(words);
+}
+
+void	test_small_vector(void)
+{
+	SMALL_VECTOR(std::string, 4)	words;
+	SMALL_VECTOR(std::string, 4)	more(2, "two");
+	SMALL_VECTOR(int, 8)			numbers;
+
+	// INLINE
+	words.push_back("one");
+	words.push_back("three");
+	words.insert(words.begin() + 1, "two");
+	words.insert(words.begin(), words.back());
+	print_elements(words);
+
+	// SPILL
+	words.insert(words.begin() + 2, more.begin(), more.end());
+	words.insert(words.end(), 3, "fill");
+	words.push_back(words[0]);
+	print_elements(words);
+	words.erase(words.begin() + 1, words.begin() + 4);
+	words.erase(words.begin());
+	print_elements(words);
+
+	// COPY, ASSIGN, SWAP, COMPARE
+	SMALL_VECTOR(std::string, 4)	copy(words);
+
+	std::cout << (copy == words) << (copy < words) << (more < words) << std::endl;
+	copy.assign(1, "single");
+	print_elements(copy);
+	copy.swap(words);
+	print_elements(copy);
+	print_elements(words);
+	more.swap(words);
+	print_elements(more);
+	print_elements(words);
+	more.swap(words);
+	words.swap(more);
+	print_elements(words);
+	print_elements(more);
+	more = copy;
+	more.resize(2);
+	more.resize(5, "resized");
+	print_elements(more);
+	for (int i = 0;i < 20;i++)
+		numbers.push_back(i * i);
+	numbers.resize(6);
+	numbers.insert(numbers.begin() + 3, numbers.begin(), numbers.begin() + 2);
+	print_elements(numbers);
+	std::cout << numbers.at(3) << " " << numbers.front() << " " << numbers.back() << std::endl;
+}
+
+#if __cplusplus >= 201103L
+void	test_vector_move(void)
+{
+	TESTED_NAMESPACE::vector<std::string>					words;
+	TESTED_NAMESPACE::vector<std::unique_ptr<int> >			owners;
+	std::string												moved("moved into place");
+
+	// EMPLACE/PUSH_BACK RVALUES
+	words.emplace_back(3, 'x');
+	words.push_back(std::move(moved));
+	words.emplace_back("emplaced");
+	words.emplace(words.begin() + 1, "middle");
+	words.emplace(words.begin(), words.back());
+	words.emplace(words.end(), 2, 'z');
+	print_vector(words);
+	for (int i = 0;i < 20;i++)
+		owners.emplace_back(new int(i));
+	owners.emplace(owners.begin() + 5, new int(-1));
+	for (size_t i = 0;i < owners.size();i++)
+		std::cout << *owners[i] << " ";
+	std::cout << std::endl;
+
+	// MOVE CONSTRUCT/ASSIGN
+	TESTED_NAMESPACE::vector<std::string>					stolen(std::move(words));
+
+	std::cout << "after move: " << words.size() << std::endl;
+	print_vector(stolen);
+	words = std::move(stolen);
+	std::cout << "after move assign: " << stolen.size() << std::endl;
+	print_vector(words);
+
+	// SMALL BUFFERS OF MOVE-ONLY ELEMENTS
+	SMALL_VECTOR(std::unique_ptr<int>, 4)					few;
+	SMALL_VECTOR(std::unique_ptr<int>, 4)					many;
+
+	few.emplace_back(new int(1));
+	for (int i = 0;i < 3;i++)
+		many.emplace_back(new int(i * 10));
+	few.swap(many);
+	for (int i = 0;i < 3;i++)
+		few.emplace_back(new int(i * 100));
+	many.swap(few);
+	std::cout << few.size() << " " << many.size() << " " << *many.back() << " " << *few.front() << std::endl;
+	std::cout << std::is_nothrow_move_constructible<SMALL_VECTOR(std::string, 4)>::value;
+	std::cout << std::is_nothrow_move_assignable<SMALL_VECTOR(std::string, 4)>::value << std::endl;
+}
 #endif
 
 void	test_vector(void)
@@ -133,6 +576,16 @@ void	test_vector(void)
 		std::cout << *it << std::endl;
 	for (TESTED_NAMESPACE::vector<int>::iterator it = vct.begin();it != vct.end();++it)
 		std::cout << *it << std::endl;
+	test_vector_insert();
+	test_vector_trivial();
+	test_vector_stream();
+	test_small_vector();
+	test_vector_bulk_erase();
+	test_vector_capacity();
+	test_vector_exceptions();
+#if __cplusplus >= 201103L
+	test_vector_move();
+#endif
 }
 
 void	print_bounds(TESTED_NAMESPACE::map<int, std::string> m, int key)
@@ -169,6 +622,22 @@ void	print_bounds(TESTED_NAMESPACE::map<std::string, int> m, std::string key)
 		std::cout << "upper_bound: " << lower_bound->first << std::endl;
 }
 
+struct case_insensitive_less
+{
+	bool operator()(const std::string& a, const std::string& b) const
+	{
+		for (size_t i = 0;i < a.size() && i < b.size();i++)
+			if (tolower(a[i]) != tolower(b[i]))
+				return (tolower(a[i]) < tolower(b[i]));
+		return (a.size() < b.size());
+	}
+};
+
+TESTED_NAMESPACE::map<int, int>	map_from_range(const TESTED_NAMESPACE::map<int, int>& m, int from)
+{
+	return (TESTED_NAMESPACE::map<int, int>(m.lower_bound(from), m.end()));
+}
+
 void	test_map(void)
 {
 	TESTED_NAMESPACE::map<int, std::string> map;
@@ -190,6 +659,16 @@ void	test_map(void)
 	std::cout << "empty: " << (map.empty()) << ", " << "size: " << map.size() << ", max_size: " << map.max_size() << std::endl;
 	map = map2;
 
+	// SELF AND EQUAL ASSIGN
+	TESTED_NAMESPACE::map<int, std::string>&	same_map = map;
+	TESTED_NAMESPACE::pair<int, std::string>	entry(7, "seven");
+	TESTED_NAMESPACE::pair<int, std::string>&	same_entry = entry;
+
+	map = same_map;
+	map2 = map;
+	entry = same_entry;
+	std::cout << map.size() << ", " << map2.size() << ", " << (map == map2) << ", " << entry.second << std::endl;
+
 	// INSERT, ITERATOR
 	map.insert(map2.begin(), map2.end());
 	for (TESTED_NAMESPACE::map<int, std::string>::iterator it = map.begin();it != map.end();++it)
@@ -214,7 +693,7 @@ void	test_map(void)
 		std::cout << it->first << ", " << it->second << std::endl;
 	
 	// COUNT, FIND, EQUAL_RANGE, LOWER_BOUND, UPPER_BOUND
-	std::cout << "count: " << map2.count(100) << ", " << map2.find(100)->second << std::endl;
+	std::cout << "count: " << map2.count(100) << ", " << (map2.find(100) == map2.end()) << std::endl;
 	std::cout << "empty: " << (map.empty()) << ", " << "size: " << map.size() << ", max_size: " << map.max_size() << std::endl;
 
 	map.swap(map2);
@@ -230,6 +709,443 @@ void	test_map(void)
 	mp.insert(TESTED_NAMESPACE::pair<std::string, int>("ft", 42));
 	mp.insert(TESTED_NAMESPACE::pair<std::string, int>("one", 1));
 	print_bounds(mp, "zaa");
+
+	// CUSTOM COMPARE
+	TESTED_NAMESPACE::map<std::string, int, case_insensitive_less> ci;
+
+	ci["Hello"] = 1;
+	ci["world"] = 2;
+	ci["HELLO"] = 3;
+	std::cout << "size: " << ci.size() << ", " << ci.find("hello")->first << ", " << ci["WORLD"] << ", count: " << ci.count("WoRlD") << std::endl;
+
+	// BALANCING
+	TESTED_NAMESPACE::map<int, int> big;
+
+	srand(42);
+	for (int i = 0;i < 5000;i++)
+		big[rand() % 10000] = i;
+	for (int i = 0;i < 5000;i++)
+		std::cout << big.erase(rand() % 10000);
+	std::cout << std::endl << "size: " << big.size() << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::iterator it = big.begin();it != big.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::reverse_iterator it = big.rbegin();it != big.rend();++it)
+		std::cout << it->first << std::endl;
+
+	// SNAPSHOT COPY
+	TESTED_NAMESPACE::map<int, int> snapshot(big);
+
+	snapshot.erase(snapshot.begin(), snapshot.lower_bound(5000));
+	snapshot[-1] = -1;
+	big = snapshot;
+	snapshot = map_from_range(big, 7000);
+	std::cout << "size: " << big.size() << ", " << snapshot.size() << ", " << (big < snapshot) << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::iterator it = snapshot.begin();it != snapshot.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+
+	// RANGE BUILD
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, int> > sorted;
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, int> > shuffled;
+
+	for (int i = 0;i < 1000;i++)
+		sorted.push_back(TESTED_NAMESPACE::make_pair(i * 3, i));
+	for (int i = 0;i < 1000;i++)
+		shuffled.push_back(TESTED_NAMESPACE::make_pair(rand() % 500, i));
+	shuffled.insert(shuffled.end(), sorted.begin(), sorted.end());
+	TESTED_NAMESPACE::map<int, int> from_sorted(sorted.begin(), sorted.end());
+	TESTED_NAMESPACE::map<int, int> from_shuffled(shuffled.begin(), shuffled.end());
+	TESTED_NAMESPACE::map<int, int> from_dups(sorted.begin(), sorted.end());
+
+	from_dups.insert(sorted.begin(), sorted.begin() + 10);
+	from_dups.insert(shuffled.begin(), shuffled.end());
+	from_sorted[1] = 1;
+	from_sorted.erase(300);
+	std::cout << "size: " << from_sorted.size() << ", " << from_shuffled.size() << ", " << from_dups.size() << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::iterator it = from_sorted.begin();it != from_sorted.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::iterator it = from_shuffled.begin();it != from_shuffled.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::reverse_iterator it = from_dups.rbegin();it != from_dups.rend();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+
+	// HINTED INSERT
+	TESTED_NAMESPACE::map<int, int> hinted;
+	TESTED_NAMESPACE::map<int, int>::iterator hint = hinted.end();
+
+	for (int i = 0;i < 200;i++)
+		hint = hinted.insert(hinted.end(), TESTED_NAMESPACE::make_pair(i * 10, i));
+	for (int i = 0;i < 200;i++)
+		hint = hinted.insert(hint, TESTED_NAMESPACE::make_pair(i * 10 + 5, i));
+	for (int i = 0;i < 200;i++)
+		hinted.insert(hinted.begin(), TESTED_NAMESPACE::make_pair(rand() % 3000 - 100, -i));
+	for (int i = 0;i < 200;i++)
+		hinted.insert(hinted.lower_bound(i * 7), TESTED_NAMESPACE::make_pair(i * 7, -i));
+	std::cout << "size: " << hinted.size() << ", " << hint->first << ", " << hinted.insert(hinted.end(), TESTED_NAMESPACE::make_pair(1995, 0))->second << std::endl;
+	for (TESTED_NAMESPACE::map<int, int>::iterator it = hinted.begin();it != hinted.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+
+	// A THROWING COPY LEAVES THE MAP AS IT WAS
+	TESTED_NAMESPACE::map<int, thrower>	guarded;
+
+	guarded[1] = thrower(1);
+	copies_left = 0;
+	try { guarded.insert(TESTED_NAMESPACE::make_pair(2, thrower(2))); } catch (const std::exception& e) { std::cout << e.what() << std::endl; }
+	copies_left = -1;
+	std::cout << "size: " << guarded.size() << ", " << guarded.count(2) << ", " << guarded.begin()->second << std::endl;
+
+	// ALLOCATOR
+	typedef ft::pool_allocator<TESTED_NAMESPACE::pair<const int, int> > pool;
+	TESTED_NAMESPACE::map<int, int, TESTED_NAMESPACE::less<int>, pool> pooled(big.begin(), big.end());
+
+	for (int i = 0;i < 5000;i++)
+		pooled.erase(rand() % 10000);
+	for (int i = 0;i < 5000;i++)
+		pooled[rand() % 10000] = i;
+	TESTED_NAMESPACE::map<int, int, TESTED_NAMESPACE::less<int>, pool> pooled_copy(pooled);
+	pooled.clear();
+	std::cout << "size: " << pooled.size() << ", " << pooled_copy.size() << std::endl;
+	pool::rebind<int>::other	rebound(pooled.get_allocator());
+
+	std::cout << (pool(rebound) == pooled.get_allocator()) << (rebound == pooled_copy.get_allocator()) << (rebound == pool()) << std::endl;
+	for (TESTED_NAMESPACE::map<int, int, TESTED_NAMESPACE::less<int>, pool>::iterator it = pooled_copy.begin();it != pooled_copy.end();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+
+	// COMPACT NODES
+	COMPACT_MAP(int, int)	compact(big.begin(), big.end());
+
+	for (int i = 0;i < 5000;i++)
+		compact.erase(rand() % 10000);
+	for (int i = 0;i < 5000;i++)
+		compact[rand() % 10000] = i;
+	compact.erase(compact.lower_bound(2000), compact.lower_bound(4000));
+	COMPACT_MAP(int, int)	compact_copy(compact);
+	compact.swap(compact_copy);
+	compact_copy.clear();
+	std::cout << "size: " << compact.size() << ", " << compact_copy.size() << std::endl;
+	for (COMPACT_MAP(int, int)::reverse_iterator it = compact.rbegin();it != compact.rend();++it)
+		std::cout << it->first << ", " << it->second << std::endl;
+
+	// BOUNDS
+	const TESTED_NAMESPACE::map<int, int>& cbig = big;
+
+	for (int key = -5;key < 10010;key += 7)
+	{
+		TESTED_NAMESPACE::map<int, int>::const_iterator lb = cbig.lower_bound(key);
+		TESTED_NAMESPACE::map<int, int>::iterator ub = big.upper_bound(key);
+		TESTED_NAMESPACE::pair<TESTED_NAMESPACE::map<int, int>::iterator, TESTED_NAMESPACE::map<int, int>::iterator> range = big.equal_range(key);
+
+		std::cout << key << ": ";
+		std::cout << (lb == cbig.end() ? -1 : lb->first) << ", ";
+		std::cout << (ub == big.end() ? -1 : ub->first) << ", ";
+		std::cout << (range.first == range.second) << std::endl;
+	}
+}
+
+void	test_flat_map(void)
+{
+	FLAT_MAP(int, std::string)											table;
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, std::string> >	sorted;
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, std::string> >	shuffled;
+
+	// INSERT, OPERATOR []
+	table[10] = "ten";
+	table[4] = "four";
+	std::cout << table.insert(TESTED_NAMESPACE::make_pair(7, std::string("seven"))).second;
+	std::cout << table.insert(TESTED_NAMESPACE::make_pair(7, std::string("again"))).second;
+	std::cout << table.insert(table.end(), TESTED_NAMESPACE::make_pair(100, std::string("hundred")))->second;
+	std::cout << table.insert(table.begin(), TESTED_NAMESPACE::make_pair(-1, std::string("minus")))->second;
+	std::cout << table.insert(table.begin(), TESTED_NAMESPACE::make_pair(8, std::string("eight")))->second << std::endl;
+
+	// RANGE INSERT: SORTED WITH DUPLICATES, THEN UNSORTED
+	for (int i = 0;i < 60;i++)
+	{
+		sorted.push_back(TESTED_NAMESPACE::make_pair(i * 2, std::string(1, 'a' + i % 26)));
+		if (i % 7 == 0)
+			sorted.push_back(TESTED_NAMESPACE::make_pair(i * 2, std::string("dup")));
+	}
+	for (int i = 0;i < 40;i++)
+		shuffled.push_back(TESTED_NAMESPACE::make_pair((i * 37) % 150 - 20, std::string(1, 'A' + i % 26)));
+	table.insert(sorted.begin(), sorted.end());
+	table.insert(shuffled.begin(), shuffled.end());
+	table.insert(sorted.begin() + 10, sorted.begin() + 20);
+	std::cout << "size: " << table.size() << ", empty: " << table.empty() << std::endl;
+	for (FLAT_MAP(int, std::string)::iterator it = table.begin();it != table.end();++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+
+	// BUILT FROM UNSORTED INPUT: THE FIRST OF EQUAL KEYS WINS
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, std::string> >	unsorted(shuffled);
+
+	for (int i = 0;i < 40;i++)
+		unsorted.push_back(TESTED_NAMESPACE::make_pair((i * 53) % 150 - 20, std::string("late")));
+	unsorted.insert(unsorted.begin() + 5, TESTED_NAMESPACE::make_pair(-1000, std::string("first")));
+	unsorted.push_back(TESTED_NAMESPACE::make_pair(-1000, std::string("last")));
+	FLAT_MAP(int, std::string)	built(unsorted.begin(), unsorted.end());
+
+	std::cout << "size: " << built.size() << std::endl;
+	for (FLAT_MAP(int, std::string)::iterator it = built.begin();it != built.end();++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+
+	// LOOKUP
+	const FLAT_MAP(int, std::string)&	ctable = table;
+
+	for (int key = -25;key < 160;key += 9)
+	{
+		FLAT_MAP(int, std::string)::const_iterator	lb = ctable.lower_bound(key);
+		FLAT_MAP(int, std::string)::iterator		ub = table.upper_bound(key);
+
+		std::cout << key << ": " << table.count(key) << ", ";
+		std::cout << (table.find(key) == table.end() ? "-" : table.find(key)->second) << ", ";
+		std::cout << (lb == ctable.end() ? -1 : lb->first) << ", ";
+		std::cout << (ub == table.end() ? -1 : ub->first) << ", ";
+		std::cout << (table.equal_range(key).first == table.equal_range(key).second) << std::endl;
+	}
+	try
+	{
+		std::cout << table.at(4) << ", " << ctable.at(100) << std::endl;
+		std::cout << table.at(3) << std::endl;
+	}
+	catch (std::out_of_range&)
+	{
+		std::cout << "out_of_range" << std::endl;
+	}
+
+	// ERASE, COPY, COMPARE, SWAP
+	FLAT_MAP(int, std::string)	copy(table);
+
+	std::cout << table.erase(4) << table.erase(3) << std::endl;
+	table.erase(table.find(10));
+	table.erase(table.lower_bound(30), table.upper_bound(60));
+	std::cout << (copy == table) << (copy < table) << (table < copy) << std::endl;
+	table.swap(copy);
+	std::cout << table.size() << ", " << copy.size() << std::endl;
+	copy = table;
+	std::cout << (copy == table) << (copy != table) << (copy <= table) << std::endl;
+	for (FLAT_MAP(int, std::string)::reverse_iterator it = table.rbegin();it != table.rend();++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+	table.clear();
+	std::cout << table.size() << ", " << table.empty() << ", " << (table.begin() == table.end()) << std::endl;
+}
+
+void	test_static_map(void)
+{
+	TESTED_NAMESPACE::map<int, int>										source;
+	TESTED_NAMESPACE::vector<TESTED_NAMESPACE::pair<int, std::string> >	unsorted;
+
+	for (int i = 0;i < 1000;i++)
+		source[(i * 7919) % 3001] = i;
+	for (int i = 0;i < 30;i++)
+		unsorted.push_back(TESTED_NAMESPACE::make_pair((i * 11) % 17, std::string(1, 'a' + i % 26)));
+
+	// CONSTRUCT FROM A MAP, FROM UNSORTED INPUT
+	const STATIC_MAP(int, int)			frozen(source.begin(), source.end());
+	const STATIC_MAP(int, std::string)	words(unsorted.begin(), unsorted.end());
+	const STATIC_MAP(int, int)			none;
+
+	std::cout << "size: " << frozen.size() << ", " << words.size() << ", " << none.size() << ", " << none.empty() << std::endl;
+	for (STATIC_MAP(int, std::string)::const_reverse_iterator it = words.rbegin();it != words.rend();++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+
+	// LOOKUP
+	for (int key = -7;key < 3020;key += 13)
+	{
+		STATIC_MAP(int, int)::const_iterator	lb = frozen.lower_bound(key);
+		STATIC_MAP(int, int)::const_iterator	ub = frozen.upper_bound(key);
+		STATIC_MAP(int, int)::const_iterator	found = frozen.find(key);
+
+		std::cout << key << ": " << frozen.count(key) << ", ";
+		std::cout << (found == frozen.end() ? -1 : found->second) << ", ";
+		std::cout << (lb == frozen.end() ? -1 : lb->first) << ", ";
+		std::cout << (ub == frozen.end() ? -1 : ub->first) << ", ";
+		std::cout << (frozen.equal_range(key).first == frozen.equal_range(key).second) << std::endl;
+	}
+	std::cout << (none.find(3) == none.end()) << (none.lower_bound(3) == none.end()) << std::endl;
+	try
+	{
+		std::cout << words.at(5) << ", " << frozen.at(0) << std::endl;
+		std::cout << words.at(17) << std::endl;
+	}
+	catch (std::out_of_range&)
+	{
+		std::cout << "out_of_range" << std::endl;
+	}
+
+	// COPY, COMPARE, SWAP
+	STATIC_MAP(int, int)	copy(frozen);
+	STATIC_MAP(int, int)	other;
+
+	std::cout << (copy == frozen) << (copy < frozen) << (none < frozen) << std::endl;
+	other.swap(copy);
+	std::cout << other.size() << ", " << copy.size() << std::endl;
+	copy = other;
+	std::cout << (copy == other) << (copy != frozen) << std::endl;
+}
+
+// Iteration order is unspecified, so only order-independent results are
+// printed; the std build checks them against std::map.
+void	test_unordered_map(void)
+{
+	UNORDERED_MAP(int, int)				table;
+	UNORDERED_MAP(std::string, int)		words;
+	const UNORDERED_MAP(int, int)		none;
+
+	// INSERT, OPERATOR[]
+	for (int i = 0;i < 2000;i++)
+		table[(i * 7919) % 3001] = i;
+	std::cout << "size: " << table.size() << ", " << table.empty() << ", " << none.size() << ", " << none.empty() << std::endl;
+	std::cout << table.insert(TESTED_NAMESPACE::make_pair(7919, 1)).second << table.insert(TESTED_NAMESPACE::make_pair(3001, 1)).second;
+	std::cout << table.insert(table.begin(), TESTED_NAMESPACE::make_pair(3001, 5))->second << std::endl;
+	for (int i = 0;i < 40;i++)
+		words[std::string(1 + i % 5, 'a' + i % 26)] += i;
+	std::cout << words["aaaaa"] << ", " << words.size() << std::endl;
+
+	// LOOKUP
+	long	sum = 0;
+
+	for (int key = -7;key < 3020;key += 13)
+	{
+		UNORDERED_MAP(int, int)::iterator	found = table.find(key);
+
+		std::cout << key << ": " << table.count(key) << ", " << (found == table.end() ? -1 : found->second) << ", ";
+		std::cout << (table.equal_range(key).first == table.equal_range(key).second) << std::endl;
+	}
+	for (UNORDERED_MAP(int, int)::const_iterator it = table.begin();it != table.end();++it)
+		sum += it->first * 3 + it->second;
+	std::cout << "sum: " << sum << std::endl;
+	std::cout << (none.find(3) == none.end()) << none.count(3) << std::endl;
+	try
+	{
+		std::cout << table.at(0) << ", " << words.at("f") << std::endl;
+		std::cout << none.at(3) << std::endl;
+	}
+	catch (std::out_of_range&)
+	{
+		std::cout << "out_of_range" << std::endl;
+	}
+
+	// HASH POLICY: IMPOSSIBLE SIZES THROW AND LEAVE THE TABLE AS IT WAS
+	try { unordered_map_rehash(table, ~size_t(0)); } catch (std::length_error&) { std::cout << "length_error" << std::endl; }
+	try { unordered_map_reserve(table, ~size_t(0)); } catch (std::length_error&) { std::cout << "length_error" << std::endl; }
+	try { unordered_map_reserve(table, ~size_t(0) / 2); } catch (std::length_error&) { std::cout << "length_error" << std::endl; }
+	unordered_map_rehash(table, 5000);
+	unordered_map_reserve(table, 3000);
+	std::cout << "size: " << table.size() << ", " << table[7919 % 3001] << std::endl;
+
+	// ERASE
+	std::cout << table.erase(0) << table.erase(0) << table.erase(-1) << std::endl;
+	for (UNORDERED_MAP(int, int)::iterator it = table.begin();it != table.end();)
+	{
+		if (it->second % 3 == 0)
+			table.erase(it++);
+		else
+			++it;
+	}
+	for (int i = 0;i < 500;i++)
+		table[i * 2] = -i;
+	sum = 0;
+	for (UNORDERED_MAP(int, int)::iterator it = table.begin();it != table.end();++it)
+		sum += it->first * 3 + it->second;
+	std::cout << "size: " << table.size() << ", sum: " << sum << std::endl;
+
+	// COPY, COMPARE, SWAP, CLEAR
+	UNORDERED_MAP(int, int)	copy(table);
+	UNORDERED_MAP(int, int)	other;
+
+	std::cout << (copy == table) << (copy != none) << std::endl;
+	copy[1] = 12345;
+	std::cout << (copy == table) << std::endl;
+	other.swap(copy);
+	std::cout << other.size() << ", " << copy.size() << std::endl;
+	copy = other;
+	copy.erase(copy.begin(), copy.end());
+	std::cout << copy.size() << ", " << copy.empty() << ", " << (copy.begin() == copy.end()) << std::endl;
+	other.clear();
+	other[4] = 4;
+	std::cout << other.size() << ", " << other[4] << ", " << (other == table) << std::endl;
+}
+
+template<class Container>
+void	print_keys(const Container& c)
+{
+	std::cout << "size: " << c.size() << std::endl;
+	for (typename Container::const_iterator it = c.begin();it != c.end();++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+}
+
+void	test_set(void)
+{
+	TESTED_NAMESPACE::vector<int>	sorted;
+	TESTED_NAMESPACE::vector<int>	unsorted;
+
+	for (int i = 0;i < 20;i++)
+	{
+		sorted.push_back(i * 3);
+		unsorted.push_back((i * 7) % 11);
+	}
+
+	// SET
+	TESTED_NAMESPACE::set<int>			set(unsorted.begin(), unsorted.end());
+	TESTED_NAMESPACE::set<int>			built(sorted.begin(), sorted.end());
+	const TESTED_NAMESPACE::set<int>	none;
+
+	print_keys(set);
+	print_keys(built);
+	std::cout << set.insert(4).second << set.insert(42).second << *set.insert(set.end(), 43) << *set.insert(set.begin(), -1) << std::endl;
+	std::cout << set.count(42) << set.count(12) << set.erase(42) << set.erase(42) << (none.find(1) == none.end()) << std::endl;
+	std::cout << *set.lower_bound(5) << ", " << *set.upper_bound(5) << ", " << (set.equal_range(12).first == set.equal_range(12).second) << std::endl;
+	set.erase(set.find(3));
+	set.erase(set.lower_bound(6), set.upper_bound(8));
+	for (TESTED_NAMESPACE::set<int>::reverse_iterator it = set.rbegin();it != set.rend();++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+	TESTED_NAMESPACE::set<int>	copy(set);
+
+	std::cout << (copy == set) << (copy < built) << (none < set) << std::endl;
+	copy.swap(built);
+	built = copy;
+	print_keys(built);
+
+	// MULTISET
+	TESTED_NAMESPACE::multiset<int>	multi(unsorted.begin(), unsorted.end());
+	TESTED_NAMESPACE::multiset<int>	grown;
+
+	multi.insert(unsorted.begin(), unsorted.end());
+	multi.insert(5);
+	multi.insert(multi.find(5), 5);
+	multi.insert(multi.end(), 100);
+	print_keys(multi);
+	std::cout << multi.count(5) << multi.count(6) << multi.count(11) << multi.erase(5) << multi.count(5) << std::endl;
+	for (int i = 0;i < 300;i++)
+		grown.insert(grown.begin(), (i * 13) % 17);
+	std::cout << grown.size() << ", " << grown.count(0) << ", " << *grown.upper_bound(15) << std::endl;
+	multi.erase(multi.begin());
+	multi.erase(multi.lower_bound(2), multi.upper_bound(4));
+	print_keys(multi);
+	std::cout << (multi == multi) << (grown < multi) << std::endl;
+
+	// MULTIMAP: equivalent keys keep their insertion order
+	TESTED_NAMESPACE::multimap<int, std::string>	mm;
+
+	for (int i = 0;i < 30;i++)
+		mm.insert(TESTED_NAMESPACE::make_pair(i % 4, std::string(1, 'a' + i)));
+	mm.insert(mm.find(2), TESTED_NAMESPACE::make_pair(2, std::string("hint")));
+	mm.insert(mm.begin(), TESTED_NAMESPACE::make_pair(3, std::string("wrong before")));
+	mm.insert(mm.find(1), TESTED_NAMESPACE::make_pair(3, std::string("wrong after")));
+	mm.insert(mm.end(), TESTED_NAMESPACE::make_pair(1, std::string("end")));
+	for (TESTED_NAMESPACE::multimap<int, std::string>::const_iterator it = mm.begin();it != mm.end();++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+	std::cout << mm.count(2) << ", " << mm.find(0)->second << ", " << mm.erase(1) << ", " << mm.size() << std::endl;
+
+	TESTED_NAMESPACE::pair<TESTED_NAMESPACE::multimap<int, std::string>::iterator, TESTED_NAMESPACE::multimap<int, std::string>::iterator>	range = mm.equal_range(3);
+
+	for (;range.first != range.second;++range.first)
+		std::cout << range.first->second << " ";
+	std::cout << std::endl;
+	TESTED_NAMESPACE::multimap<int, std::string>	mm2(mm.begin(), mm.end());
+
+	std::cout << (mm2 == mm) << (mm2 != mm) << mm2.size() << std::endl;
+	mm2.clear();
+	std::cout << mm2.size() << mm2.empty() << (mm2 < mm) << std::endl;
 }
 
 void	test_stack(void)
@@ -254,6 +1170,19 @@ void	test_stack(void)
 
 	// SIZE, EMPTY
 	std::cout << ", " << stack.size() << ", " << stack.empty() << std::endl;
+
+	// SMALL BUFFER CONTAINER
+	TESTED_NAMESPACE::stack<int, SMALL_VECTOR(int, 2)>	small_stack;
+
+	for (int i = 0;i < 5;i++)
+		small_stack.push(i * 10);
+	TESTED_NAMESPACE::stack<int, SMALL_VECTOR(int, 2)>	small_stack2(small_stack);
+
+	small_stack.pop();
+	TESTED_NAMESPACE::stack<int, SMALL_VECTOR(int, 2)>&	same_stack = small_stack;
+
+	small_stack = same_stack;
+	std::cout << small_stack.top() << ", " << small_stack.size() << ", " << (small_stack < small_stack2) << std::endl;
 }
 
 int main(int ac, char **av)
@@ -264,6 +1193,10 @@ int main(int ac, char **av)
 		{
 			case 'm':
 				test_map();
+				test_flat_map();
+				test_static_map();
+				test_unordered_map();
+				test_set();
 				break;
 			case 'v':
 				test_vector();
@@ -273,6 +1206,10 @@ int main(int ac, char **av)
 				break;
 			default:
 				test_map();
+				test_flat_map();
+				test_static_map();
+				test_unordered_map();
+				test_set();
 				test_vector();
 				test_stack();
 				break;
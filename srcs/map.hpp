@@ -14,6 +14,7 @@
 # define FT_MAP_HPP
 
 #include <memory>
+#include <stdexcept>
 #include "common.hpp"
 #include "iterator.hpp"
 #include "pair.hpp"
@@ -22,8 +23,12 @@
 namespace ft
 {
 
-	template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
-	class map
+	// Everything map and multimap share: the tree, its iterators, lookup
+	// and erasure. UniqueKeys only changes what the tree does with
+	// equivalent keys; the derived classes add the members whose
+	// signature depends on it.
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	class __map_base
 	{
 		public:
 			typedef Key																		key_type;
@@ -32,8 +37,9 @@ namespace ft
 			typedef size_t																	size_type;
 			typedef ptrdiff_t																difference_type;
 			typedef Compare																	key_compare;
-			typedef ft::AVLTree<value_type, mapped_type, key_type, key_compare>				avl_tree;
+			typedef ft::AVLTree<value_type, key_type, ft::select_first<value_type>, key_compare, Allocator, NodeBase, UniqueKeys>	avl_tree;
 			typedef typename avl_tree::node_pointer											node_pointer;
+			typedef typename avl_tree::base_pointer											base_pointer;
 			typedef typename Allocator::template rebind<value_type>::other					allocator_type;
 			typedef typename allocator_type::reference										reference;
 			typedef typename allocator_type::const_reference								const_reference;
@@ -46,7 +52,7 @@ namespace ft
 		public:
 			class value_compare : ft::binary_function<value_type, value_type, bool>
 			{
-				friend class map<Key, T, Compare, Allocator>;
+				friend class __map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>;
 				protected:
 					Compare comp;
 
@@ -57,70 +63,34 @@ namespace ft
 						return (comp(x.first, y.first));
 					}
 			};
-		public:
+		protected:
 			// MEMBERS FUNCTIONS
-			map() : tree(), comp(), allocator() {}
-			
-			template<class InputIt>
-			map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : tree(), comp(comp), allocator(alloc)
-			{
-				(void)comp;
-				while (first != last)
-				{
-					this->insert(*first);
-					++first;
-				}
-					
-			}
-
-			map(const map& other) : tree(), comp(), allocator()
-			{
-				if (*this != other)
-					*this = other;
-			}
+			__map_base() : tree(), comp(), allocator() {}
 
-			~map() {}
+			__map_base(const Compare& comp, const Allocator& alloc) : tree(comp, alloc), comp(comp), allocator(alloc) {}
 
-			allocator_type	get_allocator() const
+			__map_base(const __map_base& other) : tree(other.comp, other.allocator), comp(other.comp), allocator(other.allocator)
 			{
-				return (this->allocator);
+				this->tree.copy(other.tree);
 			}
 
-			map&	operator=(const map& other)
+			~__map_base() {}
+
+			__map_base&	operator=(const __map_base& other)
 			{
-				if (*this != other)
-					this->_copy(other.begin(), other.end());
+				if (this != &other)
+				{
+					this->tree.copy(other.tree);
+					this->comp = other.comp;
+				}
 				return (*this);
 			}
-			
-			// ELEMENT ACCESS
-			T&			at(const key_type& key)
-			{
-				node_pointer result = this->tree.find(key);
-
-				if (this->size() == 0 || result == NULL)
-					throw std::out_of_range("map::at");
-				return (result->value.second);
-			}
-
-			const T&	at(const key_type& key) const
+		public:
+			allocator_type	get_allocator() const
 			{
-				node_pointer result = this->tree.find(key);
-
-				if (this->size() == 0 || result == NULL)
-					throw std::out_of_range("map::at");
-				return (result->value.second);
+				return (this->allocator);
 			}
 
-			T&			operator[](const key_type& key)
-			{
-				node_pointer n = this->tree.find(key);
-
-				if (n != NULL)
-					return (n->value.second);
-				return (this->insert(ft::make_pair(key, T())).first->second);
-			}
-			
 			// CAPACITY
 			size_type	size() const
 			{
@@ -140,22 +110,22 @@ namespace ft
 			// ITERATORS
 			iterator 				begin()
 			{
-				return iterator(this->tree.left_eot->parent ? this->tree.left_eot->parent : this->tree.right_eot);
+				return (this->tree.begin());
 			}
 
 			const_iterator			begin() const
 			{
-				return const_iterator(this->tree.left_eot->parent ? this->tree.left_eot->parent : this->tree.right_eot);
+				return (this->tree.begin());
 			}
 			
 			iterator 				end()
 			{
-				return iterator(this->tree.right_eot->parent ? this->tree.right_eot : this->tree.right_eot);
+				return (this->tree.end());
 			}
 
 			const_iterator			end() const
 			{
-				return const_iterator(this->tree.right_eot->parent ? this->tree.right_eot : this->tree.right_eot);
+				return (this->tree.end());
 			}
 			
 			reverse_iterator		rend()
@@ -183,34 +153,21 @@ namespace ft
 			{
 				this->tree.destroy();
 			}
-			
-			ft::pair<iterator, bool>	insert(const value_type& value)
-			{
-				bool inserted = this->tree.insert(value) == 1 ? true : false;
-
-				return (ft::make_pair<iterator, bool>(iterator(this->tree.find(value.first)), inserted));
-			}
 
 			iterator					insert(iterator hint, const value_type& value)
 			{
-				(void)hint;
-				this->tree.insert(value);
-				return (iterator(this->tree.find(value.first)));
+				return (iterator(this->tree.insert_hint(hint.current, value)));
 			}
 
 			template<class InputIt>
 			void						insert(InputIt first, InputIt last)
 			{
-				while (first != last)
-				{
-					this->tree.insert(*first);
-					++first;
-				}
+				this->tree.insert_range(first, last);
 			}
 
 			void						erase(iterator pos)
 			{
-				this->tree.remove((*pos).first);
+				this->tree.remove_node(pos.current);
 			}
 
 			void						erase(iterator first, iterator last)
@@ -223,18 +180,16 @@ namespace ft
 				return (this->tree.remove(key));	
 			}
 
-			void						swap(map &other)
+			void						swap(__map_base &other)
 			{
-				ft::swap(&tree.root, &other.tree.root);
-				ft::swap(&tree.left_eot, &other.tree.left_eot);
-				ft::swap(&tree.right_eot, &other.tree.right_eot);
-				ft::swap(&tree.nodes_count, &other.tree.nodes_count);
+				this->tree.swap(other.tree);
+				ft::swap(&this->comp, &other.comp);
 			}
 			
 			// LOOKUP
 			size_type								count(const key_type& key) const
 			{
-				return (this->find(key) != this->end() ? 1 : 0);
+				return (this->tree.count(key));
 			}
 
 			iterator								find(const key_type& key)
@@ -258,42 +213,22 @@ namespace ft
 
 			iterator								lower_bound(const Key& key)
 			{
-				iterator f = this->find(key);
-
-				if (f != this->end())
-					return (f);
-				for (iterator it = this->begin();it != this->end();++it)
-					if (!this->tree.compare(it->first, key))
-						return (it);
-				return (this->end());
-			}	
+				return (iterator(this->tree.lower_bound(key)));
+			}
 
 			const_iterator							lower_bound(const Key& key) const
 			{
-				const_iterator f = this->find(key);
-
-				if (f != this->end())
-					return (f);
-				for (const_iterator it = this->begin();it != this->end();++it)
-					if (!this->tree.compare(it->first, key))
-						return (it);
-				return (this->end());
+				return (const_iterator(this->tree.lower_bound(key)));
 			}
 
 			iterator								upper_bound(const Key& key)
 			{
-				for (iterator it = this->begin();it != this->end();++it)
-					if (this->tree.compare(key, it->first))
-						return (it);
-				return (this->end());
+				return (iterator(this->tree.upper_bound(key)));
 			}
 
 			const_iterator							upper_bound(const Key& key) const
 			{
-				for (const_iterator it = this->begin();it != this->end();++it)
-					if (this->tree.compare(key, it->first))
-						return (it);
-				return (this->end());
+				return (const_iterator(this->tree.upper_bound(key)));
 			}
 
 			ft::pair<iterator,iterator>				equal_range(const Key& key)
@@ -307,74 +242,168 @@ namespace ft
 			}
 			
 			// OBSERVERS
-			key_compare key_comp() const
+			key_compare		key_comp() const
 			{
 				return (this->comp);
 			}
 
-			map::value_compare value_comp() const
+			value_compare	value_comp() const
 			{
-				return (map::value_compare(this->comp));
+				return (value_compare(this->comp));
 			}
 		public:
 			avl_tree		tree;
 		private:
 			key_compare		comp;
 			allocator_type	allocator;
-
-			template<class InputIt>
-			void			_copy(InputIt first, InputIt last)
-			{
-				this->tree.destroy();
-				while (first != last)
-				{
-					this->insert(*first);
-					++first;
-				}
-			}
 	};
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator==(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	// Comparisons and swap are written once for both containers: the
+	// arguments deduce through the derived class to its base.
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator==(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (lhs.tree == rhs.tree);
 	}
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator<(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator<(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (lhs.tree < rhs.tree);
 	}
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator!=(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator!=(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (!(lhs.tree == rhs.tree));
 	}
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator>(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator>(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (rhs.tree < lhs.tree);
 	}
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator<=(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator<=(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (!(rhs.tree < lhs.tree));
 	}
 
-	template<class Key, class T, class Compare, class Allocator>
-	inline bool	operator>=(const ft::map<Key, T, Compare, Allocator>& lhs, const ft::map<Key, T, Compare, Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator>=(const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		return (!(lhs.tree < rhs.tree));
 	}
 
-	template< class Key, class T, class Compare, class Allocator>
-	void swap(ft::map<Key, T, Compare, Allocator>& lhs, ft::map<Key,T,Compare,Allocator>& rhs)
+	template<class Key, class T, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	void swap(ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& lhs, ft::__map_base<Key, T, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
 	{
 		lhs.swap(rhs);
 	}
+
+	// NodeBase selects the node layout: ft::node_base (default) or
+	// ft::compact_node_base, one word smaller per entry.
+	template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> >, class NodeBase = ft::node_base>
+	class map : public ft::__map_base<Key, T, Compare, Allocator, NodeBase, true>
+	{
+		private:
+			typedef ft::__map_base<Key, T, Compare, Allocator, NodeBase, true>	base;
+		public:
+			typedef typename base::key_type			key_type;
+			typedef typename base::value_type		value_type;
+			typedef typename base::node_pointer		node_pointer;
+			typedef typename base::base_pointer		base_pointer;
+			typedef typename base::iterator			iterator;
+		public:
+			// MEMBERS FUNCTIONS
+			map() : base() {}
+
+			explicit map(const Compare& comp, const Allocator& alloc = Allocator()) : base(comp, alloc) {}
+			
+			template<class InputIt>
+			map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_range(first, last);
+			}
+
+			template<class InputIt>
+			map(ft::sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_sorted(first, last);
+			}
+
+			// ELEMENT ACCESS
+			T&			at(const key_type& key)
+			{
+				node_pointer result = this->tree.find(key);
+
+				if (this->size() == 0 || result == NULL)
+					throw std::out_of_range("map::at");
+				return (result->value.second);
+			}
+
+			const T&	at(const key_type& key) const
+			{
+				node_pointer result = this->tree.find(key);
+
+				if (this->size() == 0 || result == NULL)
+					throw std::out_of_range("map::at");
+				return (result->value.second);
+			}
+
+			T&			operator[](const key_type& key)
+			{
+				base_pointer	parent;
+				bool			to_left;
+				node_pointer	n = this->tree.find_insert_pos(key, parent, to_left);
+
+				if (n == NULL)
+					n = this->tree.insert_at(parent, to_left, value_type(key, T()));
+				return (n->value.second);
+			}
+
+			// MODIFIERS
+			using base::insert;
+
+			ft::pair<iterator, bool>	insert(const value_type& value)
+			{
+				ft::pair<node_pointer, bool> result = this->tree.insert(value);
+
+				return (ft::make_pair<iterator, bool>(iterator(result.first), result.second));
+			}
+	};
+
+	// Same tree as map, with equivalent keys kept side by side in
+	// insertion order.
+	template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> >, class NodeBase = ft::node_base>
+	class multimap : public ft::__map_base<Key, T, Compare, Allocator, NodeBase, false>
+	{
+		private:
+			typedef ft::__map_base<Key, T, Compare, Allocator, NodeBase, false>	base;
+		public:
+			typedef typename base::value_type		value_type;
+			typedef typename base::iterator			iterator;
+		public:
+			// MEMBERS FUNCTIONS
+			multimap() : base() {}
+
+			explicit multimap(const Compare& comp, const Allocator& alloc = Allocator()) : base(comp, alloc) {}
+
+			template<class InputIt>
+			multimap(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_range(first, last);
+			}
+
+			// MODIFIERS
+			using base::insert;
+
+			iterator	insert(const value_type& value)
+			{
+				return (iterator(this->tree.insert(value).first));
+			}
+	};
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -38,7 +38,7 @@ namespace ft
 		
 		pair&	operator=(const pair& other)
 		{
-			if (*this != other)
+			if (this != &other)
 			{
 				first = other.first;
 				second = other.second;
@@ -0,0 +1,238 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/11 10:14:52 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/11 10:14:52 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_POOL_ALLOCATOR_HPP
+# define FT_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <limits>
+
+namespace ft
+{
+	// Pools shared by an allocator and all its rebound copies: one free
+	// list per block size, kept alive by a reference count. Blocks are
+	// sized and aligned for any object, so the group itself is untyped.
+	struct	__pool_group
+	{
+		union	max_align
+		{
+			long double	ld;
+			long		l;
+			void*		p;
+		};
+
+		struct	pool
+		{
+			pool*	next;
+			size_t	block_size;
+			size_t	slab_size;
+			void*	free_list;
+			void*	slabs;
+		};
+
+		size_t	refs;
+		pool*	pools;
+
+		static __pool_group*	create()
+		{
+			__pool_group*	g = new __pool_group;
+
+			g->refs = 1;
+			g->pools = NULL;
+			return (g);
+		}
+
+		static size_t	round_up(size_t size)
+		{
+			return ((size + sizeof(max_align) - 1) / sizeof(max_align) * sizeof(max_align));
+		}
+
+		// The pool for blocks of size bytes, created on first use.
+		pool*	get(size_t size, size_t slab_size)
+		{
+			size = round_up(size < sizeof(void*) ? sizeof(void*) : size);
+			for (pool* p = this->pools;p != NULL;p = p->next)
+				if (p->block_size == size)
+					return (p);
+
+			pool*	p = new pool;
+
+			p->next = this->pools;
+			p->block_size = size;
+			p->slab_size = slab_size;
+			p->free_list = NULL;
+			p->slabs = NULL;
+			this->pools = p;
+			return (p);
+		}
+
+		// A slab starts with a link to the previous one, padded to the
+		// block alignment, then holds slab_size blocks.
+		static void	grow(pool* p)
+		{
+			size_t	header = round_up(sizeof(void*));
+			char*	s = static_cast<char*>(::operator new(header + p->block_size * p->slab_size));
+
+			*reinterpret_cast<void**>(s) = p->slabs;
+			p->slabs = s;
+			for (size_t i = p->slab_size;i > 0;i--)
+			{
+				void*	b = s + header + (i - 1) * p->block_size;
+
+				*static_cast<void**>(b) = p->free_list;
+				p->free_list = b;
+			}
+		}
+
+		void	release()
+		{
+			if (--this->refs != 0)
+				return ;
+			while (this->pools != NULL)
+			{
+				pool*	next = this->pools->next;
+
+				while (this->pools->slabs != NULL)
+				{
+					void*	slab = this->pools->slabs;
+
+					this->pools->slabs = *static_cast<void**>(slab);
+					::operator delete(slab);
+				}
+				delete this->pools;
+				this->pools = next;
+			}
+			delete this;
+		}
+	};
+
+	// Fixed-size node allocator: single-object requests are carved out of
+	// slabs of SlabSize objects and recycled through a free list, so node
+	// containers get O(1) alloc/free and contiguous nodes. Copies and
+	// rebound copies share one pool group and compare equal, so memory
+	// may be freed through any of them.
+	template<class T, size_t SlabSize = 256>
+	class pool_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template<class U>
+			struct rebind { typedef pool_allocator<U, SlabSize> other; };
+
+			template<class U, size_t S>
+			friend class pool_allocator;
+		public:
+			pool_allocator() : group(__pool_group::create()), pool(group->get(sizeof(T), SlabSize)) {}
+
+			pool_allocator(const pool_allocator& other) : group(other.group), pool(other.pool)
+			{
+				++this->group->refs;
+			}
+
+			template<class U>
+			pool_allocator(const pool_allocator<U, SlabSize>& other) : group(other.group), pool(other.group->get(sizeof(T), SlabSize))
+			{
+				++this->group->refs;
+			}
+
+			~pool_allocator()
+			{
+				this->group->release();
+			}
+
+			pool_allocator&	operator=(const pool_allocator& other)
+			{
+				if (this->group != other.group)
+				{
+					++other.group->refs;
+					this->group->release();
+					this->group = other.group;
+				}
+				this->pool = other.pool;
+				return (*this);
+			}
+
+			pointer			address(reference x) const
+			{
+				return (&x);
+			}
+
+			const_pointer	address(const_reference x) const
+			{
+				return (&x);
+			}
+
+			pointer			allocate(size_type n, const void* = 0)
+			{
+				if (n != 1)
+					return (static_cast<pointer>(::operator new(n * sizeof(T))));
+				if (this->pool->free_list == NULL)
+					__pool_group::grow(this->pool);
+
+				void*	b = this->pool->free_list;
+
+				this->pool->free_list = *static_cast<void**>(b);
+				return (static_cast<pointer>(b));
+			}
+
+			void			deallocate(pointer p, size_type n)
+			{
+				if (n != 1)
+				{
+					::operator delete(p);
+					return ;
+				}
+				*reinterpret_cast<void**>(p) = this->pool->free_list;
+				this->pool->free_list = p;
+			}
+
+			size_type		max_size() const
+			{
+				return (std::numeric_limits<size_type>::max() / sizeof(T));
+			}
+
+			void			construct(pointer p, const_reference value)
+			{
+				::new (static_cast<void*>(p)) T(value);
+			}
+
+			void			destroy(pointer p)
+			{
+				p->~T();
+			}
+
+			template<class U>
+			bool			operator==(const pool_allocator<U, SlabSize>& other) const
+			{
+				return (this->group == other.group);
+			}
+
+			template<class U>
+			bool			operator!=(const pool_allocator<U, SlabSize>& other) const
+			{
+				return (this->group != other.group);
+			}
+		private:
+			__pool_group*			group;
+			__pool_group::pool*		pool;
+	};
+}
+
+#endif
@@ -0,0 +1,311 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/21 16:04:12 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/21 16:04:12 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SET_HPP
+# define FT_SET_HPP
+
+#include <memory>
+#include "common.hpp"
+#include "iterator.hpp"
+#include "pair.hpp"
+#include "avltree.hpp"
+
+namespace ft
+{
+
+	// Everything set and multiset share: the map's tree storing bare
+	// keys, with the derived classes adding what depends on UniqueKeys.
+	// Elements are immutable, so iterator and const_iterator are the
+	// same constant iterator.
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	class __set_base
+	{
+		public:
+			typedef Key																		key_type;
+			typedef Key																		value_type;
+			typedef size_t																	size_type;
+			typedef ptrdiff_t																difference_type;
+			typedef Compare																	key_compare;
+			typedef Compare																	value_compare;
+			typedef ft::AVLTree<value_type, key_type, ft::identity<value_type>, key_compare, Allocator, NodeBase, UniqueKeys>	avl_tree;
+			typedef typename avl_tree::node_pointer											node_pointer;
+			typedef typename Allocator::template rebind<value_type>::other					allocator_type;
+			typedef typename allocator_type::reference										reference;
+			typedef typename allocator_type::const_reference								const_reference;
+			typedef typename allocator_type::pointer										pointer;
+			typedef typename allocator_type::const_pointer									const_pointer;
+			typedef typename avl_tree::const_iterator	 									iterator;
+			typedef typename avl_tree::const_iterator	 									const_iterator;
+			typedef typename avl_tree::const_reverse_iterator 								reverse_iterator;
+			typedef typename avl_tree::const_reverse_iterator 								const_reverse_iterator;
+		protected:
+			// MEMBERS FUNCTIONS
+			__set_base() : tree(), comp(), allocator() {}
+
+			__set_base(const Compare& comp, const Allocator& alloc) : tree(comp, alloc), comp(comp), allocator(alloc) {}
+
+			__set_base(const __set_base& other) : tree(other.comp, other.allocator), comp(other.comp), allocator(other.allocator)
+			{
+				this->tree.copy(other.tree);
+			}
+
+			~__set_base() {}
+
+			__set_base&	operator=(const __set_base& other)
+			{
+				if (this != &other)
+				{
+					this->tree.copy(other.tree);
+					this->comp = other.comp;
+				}
+				return (*this);
+			}
+		public:
+			allocator_type	get_allocator() const
+			{
+				return (this->allocator);
+			}
+
+			// CAPACITY
+			size_type	size() const
+			{
+				return (this->tree.size());
+			}
+
+			bool		empty() const
+			{
+				return (this->size() == 0);
+			}
+
+			size_type	max_size() const
+			{
+				return (this->tree.allocator.max_size());
+			}
+
+			// ITERATORS
+			iterator				begin() const
+			{
+				return (this->tree.begin());
+			}
+
+			iterator				end() const
+			{
+				return (this->tree.end());
+			}
+
+			reverse_iterator		rbegin() const
+			{
+				return reverse_iterator(this->end());
+			}
+
+			reverse_iterator		rend() const
+			{
+				return reverse_iterator(this->begin());
+			}
+
+			// MODIFIERS
+			void						clear()
+			{
+				this->tree.destroy();
+			}
+
+			iterator					insert(iterator hint, const value_type& value)
+			{
+				return (iterator(this->tree.insert_hint(hint.current, value)));
+			}
+
+			template<class InputIt>
+			void						insert(InputIt first, InputIt last)
+			{
+				this->tree.insert_range(first, last);
+			}
+
+			void						erase(iterator pos)
+			{
+				this->tree.remove_node(pos.current);
+			}
+
+			void						erase(iterator first, iterator last)
+			{
+				this->tree.remove(first, last);
+			}
+
+			size_type					erase(const key_type& key)
+			{
+				return (this->tree.remove(key));
+			}
+
+			void						swap(__set_base &other)
+			{
+				this->tree.swap(other.tree);
+				ft::swap(&this->comp, &other.comp);
+			}
+
+			// LOOKUP
+			size_type					count(const key_type& key) const
+			{
+				return (this->tree.count(key));
+			}
+
+			iterator					find(const key_type& key) const
+			{
+				node_pointer n = this->tree.find(key);
+
+				if (n == NULL)
+					return (this->end());
+				return (iterator(n));
+			}
+
+			iterator					lower_bound(const key_type& key) const
+			{
+				return (iterator(this->tree.lower_bound(key)));
+			}
+
+			iterator					upper_bound(const key_type& key) const
+			{
+				return (iterator(this->tree.upper_bound(key)));
+			}
+
+			ft::pair<iterator,iterator>	equal_range(const key_type& key) const
+			{
+				return (ft::make_pair<iterator, iterator>(this->lower_bound(key), this->upper_bound(key)));
+			}
+
+			// OBSERVERS
+			key_compare		key_comp() const
+			{
+				return (this->comp);
+			}
+
+			value_compare	value_comp() const
+			{
+				return (this->comp);
+			}
+		public:
+			avl_tree		tree;
+		private:
+			key_compare		comp;
+			allocator_type	allocator;
+	};
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator==(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (lhs.tree == rhs.tree);
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator<(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (lhs.tree < rhs.tree);
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator!=(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (!(lhs.tree == rhs.tree));
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator>(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (rhs.tree < lhs.tree);
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator<=(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (!(rhs.tree < lhs.tree));
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	inline bool	operator>=(const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, const ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		return (!(lhs.tree < rhs.tree));
+	}
+
+	template<class Key, class Compare, class Allocator, class NodeBase, bool UniqueKeys>
+	void swap(ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& lhs, ft::__set_base<Key, Compare, Allocator, NodeBase, UniqueKeys>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+
+	template<class Key, class Compare = ft::less<Key>, class Allocator = std::allocator<Key>, class NodeBase = ft::node_base>
+	class set : public ft::__set_base<Key, Compare, Allocator, NodeBase, true>
+	{
+		private:
+			typedef ft::__set_base<Key, Compare, Allocator, NodeBase, true>	base;
+		public:
+			typedef typename base::value_type		value_type;
+			typedef typename base::node_pointer		node_pointer;
+			typedef typename base::iterator			iterator;
+		public:
+			// MEMBERS FUNCTIONS
+			set() : base() {}
+
+			explicit set(const Compare& comp, const Allocator& alloc = Allocator()) : base(comp, alloc) {}
+
+			template<class InputIt>
+			set(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_range(first, last);
+			}
+
+			template<class InputIt>
+			set(ft::sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_sorted(first, last);
+			}
+
+			// MODIFIERS
+			using base::insert;
+
+			ft::pair<iterator, bool>	insert(const value_type& value)
+			{
+				ft::pair<node_pointer, bool> result = this->tree.insert(value);
+
+				return (ft::make_pair<iterator, bool>(iterator(result.first), result.second));
+			}
+	};
+
+	// set with equivalent keys kept side by side in insertion order.
+	template<class Key, class Compare = ft::less<Key>, class Allocator = std::allocator<Key>, class NodeBase = ft::node_base>
+	class multiset : public ft::__set_base<Key, Compare, Allocator, NodeBase, false>
+	{
+		private:
+			typedef ft::__set_base<Key, Compare, Allocator, NodeBase, false>	base;
+		public:
+			typedef typename base::value_type		value_type;
+			typedef typename base::iterator			iterator;
+		public:
+			// MEMBERS FUNCTIONS
+			multiset() : base() {}
+
+			explicit multiset(const Compare& comp, const Allocator& alloc = Allocator()) : base(comp, alloc) {}
+
+			template<class InputIt>
+			multiset(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : base(comp, alloc)
+			{
+				this->tree.insert_range(first, last);
+			}
+
+			// MODIFIERS
+			using base::insert;
+
+			iterator	insert(const value_type& value)
+			{
+				return (iterator(this->tree.insert(value).first));
+			}
+	};
+};
+
+#endif
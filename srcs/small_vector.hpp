@@ -0,0 +1,815 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/14 09:41:07 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/14 09:41:07 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SMALL_VECTOR_HPP
+# define FT_SMALL_VECTOR_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include "iterator.hpp"
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "common.hpp"
+#include "growth_policy.hpp"
+
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+namespace ft
+{
+	// A vector whose first N elements live inside the object: it only
+	// allocates once it grows past N. Interface, iterators and comparisons
+	// are those of ft::vector, so it can back an ft::stack.
+	template<class T, size_t N, class Allocator = std::allocator<T> >
+	class	small_vector
+	{
+		public:
+			typedef T													value_type;
+			typedef typename Allocator::template rebind<T>::other		allocator_type;
+			typedef size_t												size_type;
+			typedef ptrdiff_t											difference_type;
+			typedef typename allocator_type::reference					reference;
+			typedef typename allocator_type::const_reference			const_reference;
+			typedef typename allocator_type::pointer					pointer;
+			typedef typename allocator_type::const_pointer				const_pointer;
+			typedef ft::normal_iterator<pointer, small_vector> 			iterator;
+			typedef ft::normal_iterator<const_pointer, small_vector>	const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+		public:
+			// MEMBER FUNCTIONS
+			small_vector(void) : start(inline_data()), finish(start), end_of_storage(start + N), allocator() {}
+
+			explicit small_vector(const Allocator &_allocator) : start(inline_data()), finish(start), end_of_storage(start + N), allocator(_allocator) {}
+
+			explicit small_vector(size_type size, const T &value = T(), const Allocator &_allocator = Allocator()) : start(inline_data()), finish(start), end_of_storage(start + N), allocator(_allocator)
+			{
+				this->assign(size, value);
+			}
+
+			template<class InputIt>
+			small_vector(InputIt first, InputIt last, const Allocator &_allocator = Allocator()) : start(inline_data()), finish(start), end_of_storage(start + N), allocator(_allocator)
+			{
+				this->assign(first, last);
+			}
+
+			small_vector(const small_vector &other) : start(inline_data()), finish(start), end_of_storage(start + N), allocator(other.allocator)
+			{
+				this->assign(other.begin(), other.end());
+			}
+
+#if __cplusplus >= 201103L
+			// A spilled buffer is stolen; inline elements have to be moved
+			// one by one.
+			small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible<T>::value) : start(inline_data()), finish(start), end_of_storage(start + N), allocator(std::move(other.allocator))
+			{
+				this->steal(other);
+			}
+#endif
+
+			~small_vector(void)
+			{
+				this->destroy_it(this->start, this->finish);
+				this->release();
+			}
+
+			allocator_type	get_allocator_type(void) const
+			{
+				return (this->allocator);
+			}
+
+			small_vector	&operator=(const small_vector &other)
+			{
+				if (this != &other)
+					this->assign_range(other.start, other.finish, ft::forward_iterator_tag());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			small_vector	&operator=(small_vector &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+			{
+				if (this != &other)
+				{
+					this->clear();
+					this->release();
+					this->steal(other);
+				}
+				return (*this);
+			}
+#endif
+
+			void			assign(size_type count, const_reference value)
+			{
+				this->assign_dispatch(count, value, true_type());
+			}
+
+			template<class InputIt>
+			void			assign(InputIt first, InputIt last)
+			{
+				typedef typename ft::is_integral<InputIt>::type integral;
+
+				this->assign_dispatch(first, last, integral());
+			}
+
+			// ITERATORS
+			iterator 			begin()
+			{
+				return iterator(this->start);
+			}
+
+			const_iterator		begin() const
+			{
+				return const_iterator(this->start);
+			}
+
+			iterator 			end()
+			{
+				return iterator(this->finish);
+			}
+
+			const_iterator		end() const
+			{
+				return const_iterator(this->finish);
+			}
+
+			reverse_iterator		rend()
+			{
+				return reverse_iterator(begin());
+			}
+
+			const_reverse_iterator 	rend() const
+			{
+				return const_reverse_iterator(begin());
+			}
+
+			reverse_iterator 	rbegin()
+			{
+				return reverse_iterator(end());
+			}
+
+			const_reverse_iterator 	rbegin() const
+			{
+				return const_reverse_iterator(end());
+			}
+
+			// CAPACITY
+			bool				empty(void) const
+			{
+				return (this->finish == this->start);
+			}
+
+			size_type			size(void) const
+			{
+				return (this->finish - this->start);
+			}
+
+			size_type			max_size(void) const
+			{
+				return (this->allocator.max_size());
+			}
+
+			void				reserve(size_type new_cap)
+			{
+				if (new_cap > this->max_size())
+					throw std::length_error("small_vector::reserve");
+				if (this->capacity() < new_cap)
+					this->reallocate(new_cap);
+			}
+
+			size_type			capacity(void) const
+			{
+				return (size_type(this->end_of_storage - this->start));
+			}
+
+			// Fits the heap block to size(), or moves back into the inline
+			// buffer when the elements fit there again.
+			void				shrink_to_fit(void)
+			{
+				if (this->is_inline() || this->capacity() == this->size())
+					return ;
+				if (this->size() > N)
+				{
+					this->reallocate(this->size());
+					return ;
+				}
+				pointer		old_start = this->start;
+				pointer		old_finish = this->finish;
+				size_type	old_capacity = this->capacity();
+
+				this->finish = ft::uninitialized_move_if_noexcept(old_start, old_finish, this->inline_data());
+				this->start = this->inline_data();
+				this->end_of_storage = this->start + N;
+				this->destroy_it(old_start, old_finish);
+				this->allocator.deallocate(old_start, old_capacity);
+			}
+
+			// True while the elements still live in the inline buffer.
+			bool				is_inline(void) const
+			{
+				return (this->start == this->inline_data());
+			}
+
+			// ELEMENT ACCESS
+			reference			operator[](size_type index)
+			{
+				return (*(this->start + index));
+			}
+
+			const_reference		operator[](size_type index) const
+			{
+				return (*(this->start + index));
+			}
+
+			reference			at(size_type index)
+			{
+				if (index >= this->size())
+					throw std::out_of_range("small_vector: out of range");
+				return ((*this)[index]);
+			}
+
+			const_reference		at(size_type index) const
+			{
+				if (index >= this->size())
+					throw std::out_of_range("small_vector: out of range");
+				return ((*this)[index]);
+			}
+
+			reference			front(void)
+			{
+				return (*(this->begin()));
+			}
+
+			const_reference		front(void) const
+			{
+				return (*(this->begin()));
+			}
+
+			reference			back(void)
+			{
+				return (*(this->end() - 1));
+			}
+
+			const_reference		back(void) const
+			{
+				return (*(this->end() - 1));
+			}
+
+			pointer				data(void)
+			{
+				return (this->empty() ? NULL : this->start);
+			}
+
+			const_pointer		data(void) const
+			{
+				return (this->empty() ? NULL : this->start);
+			}
+
+			// MODIFIERS
+			void				clear(void)
+			{
+				this->erase_at_end(this->start);
+			}
+
+			void				push_back(const_reference value)
+			{
+				if (this->finish != this->end_of_storage)
+				{
+					this->allocator.construct(this->finish, value);
+					this->finish++;
+					return ;
+				}
+				value_type	copy(value);
+
+				this->reallocate(this->new_size(this->size() + 1));
+				this->allocator.construct(this->finish, copy);
+				this->finish++;
+			}
+
+			void				pop_back()
+			{
+				--this->finish;
+				this->allocator.destroy(this->finish);
+			}
+
+#if __cplusplus >= 201103L
+			void				push_back(value_type &&value)
+			{
+				this->emplace_back(std::move(value));
+			}
+
+			template<class... Args>
+			void				emplace_back(Args&&... args)
+			{
+				if (this->finish != this->end_of_storage)
+				{
+					::new (static_cast<void*>(this->finish)) value_type(std::forward<Args>(args)...);
+					this->finish++;
+					return ;
+				}
+				value_type	tmp(std::forward<Args>(args)...);
+
+				this->reallocate(this->new_size(this->size() + 1));
+				::new (static_cast<void*>(this->finish)) value_type(std::move(tmp));
+				this->finish++;
+			}
+
+			template<class... Args>
+			iterator			emplace(const_iterator pos, Args&&... args)
+			{
+				size_type	_pos = pos - const_iterator(this->start);
+				value_type	tmp(std::forward<Args>(args)...);
+
+				if (this->finish == this->end_of_storage)
+					this->reallocate(this->new_size(this->size() + 1));
+				if (this->start + _pos == this->finish)
+					::new (static_cast<void*>(this->finish)) value_type(std::move(tmp));
+				else
+				{
+					::new (static_cast<void*>(this->finish)) value_type(std::move(*(this->finish - 1)));
+					std::move_backward(this->start + _pos, this->finish - 1, this->finish);
+					*(this->start + _pos) = std::move(tmp);
+				}
+				++this->finish;
+				return (this->begin() + _pos);
+			}
+#endif
+
+			iterator			insert(iterator pos, const T &value)
+			{
+				size_type	_pos = pos - this->begin();
+
+				if (this->finish == this->end_of_storage)
+				{
+					value_type	copy(value);
+
+					this->reallocate(this->new_size(this->size() + 1));
+					this->insert_in_place(_pos, copy);
+				}
+				else
+					this->insert_in_place(_pos, value);
+				return (this->begin() + _pos);
+			}
+
+			void				insert(iterator pos, size_type amount, const_reference value)
+			{
+				this->insert_dispatch(pos, amount, value, true_type());
+			}
+
+			template<class InputIt>
+			void				insert(iterator pos, InputIt first, InputIt last)
+			{
+				typedef typename ft::is_integral<InputIt>::type integral;
+
+				this->insert_dispatch(pos, first, last, integral());
+			}
+
+			iterator			erase(iterator pos)
+			{
+				ft::move(pos.base() + 1, this->finish, pos.base());
+				this->pop_back();
+				return (pos);
+			}
+
+			iterator			erase(iterator first, iterator last)
+			{
+				if (first != last)
+					this->erase_at_end(ft::move(last.base(), this->finish, first.base()));
+				return (first);
+			}
+
+			// Erases pos by moving the last element into its place: O(1), but
+			// the order of the elements is not kept.
+			iterator			swap_and_pop(iterator pos)
+			{
+				if (pos.base() != this->finish - 1)
+					ft::__move_assign(*pos, *(this->finish - 1));
+				this->pop_back();
+				return (pos);
+			}
+
+			void				resize(size_type count, value_type value = value_type())
+			{
+				if (count < this->size())
+					this->erase_at_end(this->start + count);
+				else if (count > this->size())
+					this->insert(this->end(), count - this->size(), value);
+			}
+
+			// O(1) when both sides have spilled to the heap. Inline elements
+			// are exchanged in place: the common prefix is swapped element by
+			// element and the rest is relocated (moved since C++11).
+			void				swap(small_vector &other)
+			{
+				if (this == &other)
+					return ;
+				if (!this->is_inline() && !other.is_inline())
+				{
+					ft::swap(&other.start, &this->start);
+					ft::swap(&other.finish, &this->finish);
+					ft::swap(&other.end_of_storage, &this->end_of_storage);
+				}
+				else if (this->is_inline() && other.is_inline())
+				{
+					small_vector&	shorter = this->size() < other.size() ? *this : other;
+					small_vector&	longer = this->size() < other.size() ? other : *this;
+					size_type		common = shorter.size();
+
+					for (size_type i = 0;i < common;i++)
+						std::swap(shorter.start[i], longer.start[i]);
+					shorter.finish = this->relocate(longer.start + common, longer.finish, shorter.finish);
+					longer.erase_at_end(longer.start + common);
+				}
+				else
+				{
+					small_vector&	inline_side = this->is_inline() ? *this : other;
+					small_vector&	heap_side = this->is_inline() ? other : *this;
+					pointer			heap_start = heap_side.start;
+					pointer			heap_finish = heap_side.finish;
+					pointer			heap_end = heap_side.end_of_storage;
+
+					heap_side.finish = this->relocate(inline_side.start, inline_side.finish, heap_side.inline_data());
+					heap_side.start = heap_side.inline_data();
+					heap_side.end_of_storage = heap_side.start + N;
+					inline_side.erase_at_end(inline_side.start);
+					inline_side.start = heap_start;
+					inline_side.finish = heap_finish;
+					inline_side.end_of_storage = heap_end;
+				}
+				ft::swap(&other.allocator, &this->allocator);
+			}
+		private:
+			union	storage
+			{
+				long double	align;
+				void*		align_pointer;
+				char		data[sizeof(T) * N];
+			};
+
+			pointer			start;
+			pointer			finish;
+			pointer			end_of_storage;
+			allocator_type	allocator;
+			storage			buffer;
+
+			pointer			inline_data(void)
+			{
+				return (reinterpret_cast<pointer>(this->buffer.data));
+			}
+
+			const_pointer	inline_data(void) const
+			{
+				return (reinterpret_cast<const_pointer>(this->buffer.data));
+			}
+
+			// Gives the heap block back, if any, and points at the inline
+			// buffer again. The elements must already be destroyed.
+			void			release(void)
+			{
+				if (!this->is_inline())
+					this->allocator.deallocate(this->start, this->capacity());
+				this->start = this->inline_data();
+				this->finish = this->start;
+				this->end_of_storage = this->start + N;
+			}
+
+			// Empty storage for at least count elements, assuming the
+			// current one was released.
+			void			allocate_storage(size_type count)
+			{
+				if (count <= N)
+					return ;
+				this->start = this->allocator.allocate(count);
+				this->finish = this->start;
+				this->end_of_storage = this->start + count;
+			}
+
+			size_type		new_size(size_type n)
+			{
+				if (n > this->max_size())
+					throw std::length_error("small_vector: max_size exceeded");
+
+				size_type capacity = ft::double_growth::next_capacity(this->size(), n, sizeof(value_type));
+
+				return (capacity > this->max_size() ? this->max_size() : capacity);
+			}
+
+			// Moves the elements to a heap block of the given capacity.
+			void			reallocate(size_type capacity)
+			{
+				pointer		_start(this->allocator.allocate(capacity));
+				pointer		_finish(_start);
+
+				try
+				{
+					_finish = ft::uninitialized_move_if_noexcept(this->start, this->finish, _start);
+				}
+				catch (...)
+				{
+					this->allocator.deallocate(_start, capacity);
+					throw ;
+				}
+				this->destroy_it(this->start, this->finish);
+				this->release();
+				this->start = _start;
+				this->finish = _finish;
+				this->end_of_storage = _start + capacity;
+			}
+
+#if __cplusplus >= 201103L
+			void			steal(small_vector &other)
+			{
+				if (other.is_inline())
+				{
+					this->assign(std::make_move_iterator(other.start), std::make_move_iterator(other.finish));
+					other.clear();
+					return ;
+				}
+				this->start = other.start;
+				this->finish = other.finish;
+				this->end_of_storage = other.end_of_storage;
+				other.start = other.inline_data();
+				other.finish = other.start;
+				other.end_of_storage = other.start + N;
+			}
+#endif
+
+			// Builds [first, last) at d_first for a swap: moved since C++11,
+			// copied before. On failure nothing built is left behind.
+			pointer			relocate(pointer first, pointer last, pointer d_first)
+			{
+#if __cplusplus >= 201103L
+				return (ft::__uninitialized_copy_loop(std::make_move_iterator(first), std::make_move_iterator(last), d_first));
+#else
+				return (ft::uninitialized_copy(first, last, d_first));
+#endif
+			}
+
+			void			erase_at_end(pointer pos)
+			{
+				this->destroy_it(pos, this->finish);
+				this->finish = pos;
+			}
+
+			void			destroy_it(pointer first, pointer last)
+			{
+				this->destroy_it(first, last, typename ft::is_trivially_destructible<value_type>::type());
+			}
+
+			void			destroy_it(pointer, pointer, true_type) {}
+
+			void			destroy_it(pointer first, pointer last, false_type)
+			{
+				for (;first != last; ++first)
+					this->allocator.destroy(first);
+			}
+
+			void			assign_dispatch(size_type count, const_reference value, true_type)
+			{
+				if (count > this->capacity())
+				{
+					value_type	copy(value);
+
+					this->clear();
+					this->release();
+					this->allocate_storage(count);
+					this->finish = ft::uninitialized_fill_n(this->start, count, copy);
+				}
+				else if (count > this->size())
+				{
+					ft::fill(this->start, this->finish, value);
+					this->finish = ft::uninitialized_fill_n(this->finish, count - this->size(), value);
+				}
+				else
+				{
+					ft::fill(this->start, this->start + count, value);
+					this->erase_at_end(this->start + count);
+				}
+			}
+
+			template<class InputIt>
+			void			assign_dispatch(InputIt first, InputIt last, false_type)
+			{
+				this->assign_range(first, last, ft::iterator_category(first));
+			}
+
+			template<class InputIt>
+			void			assign_range(InputIt first, InputIt last, ft::input_iterator_tag)
+			{
+				pointer	cur = this->start;
+
+				for (;first != last && cur != this->finish;++first, ++cur)
+					*cur = *first;
+				if (first == last)
+					this->erase_at_end(cur);
+				else
+					for (;first != last;++first)
+						this->push_back(*first);
+			}
+
+			template<class ForwardIt>
+			void			assign_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+			{
+				size_type	count = ft::distance(first, last);
+
+				if (count > this->capacity())
+				{
+					this->clear();
+					this->release();
+					this->allocate_storage(count);
+					this->finish = ft::uninitialized_copy(first, last, this->start);
+				}
+				else if (count > this->size())
+				{
+					ForwardIt	mid = first;
+
+					ft::advance(mid, this->size());
+					ft::copy(first, mid, this->start);
+					this->finish = ft::uninitialized_copy(mid, last, this->finish);
+				}
+				else
+					this->erase_at_end(ft::copy(first, last, this->start));
+			}
+
+			void			insert_dispatch(iterator pos, size_type count, const_reference value, true_type)
+			{
+				size_type	_pos = pos - this->begin();
+
+				if (count > size_type(this->end_of_storage - this->finish))
+				{
+					value_type	copy(value);
+
+					this->reallocate(this->new_size(this->size() + count));
+					this->insert_fill_in_place(_pos, count, copy);
+				}
+				else
+					this->insert_fill_in_place(_pos, count, value);
+			}
+
+			template<class InputIt>
+			void			insert_dispatch(iterator pos, InputIt first, InputIt last, false_type)
+			{
+				this->insert_range(pos, first, last, ft::iterator_category(first));
+			}
+
+			template<class InputIt>
+			void			insert_range(iterator pos, InputIt first, InputIt last, ft::input_iterator_tag)
+			{
+				if (pos.base() == this->finish)
+				{
+					for (;first != last;++first)
+						this->push_back(*first);
+					return ;
+				}
+				small_vector	tmp(first, last);
+
+				this->insert_range(pos, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+			}
+
+			template<class ForwardIt>
+			void			insert_range(iterator pos, ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+			{
+				size_type	_pos = pos - this->begin();
+				size_type	count = ft::distance(first, last);
+
+				if (count > size_type(this->end_of_storage - this->finish))
+					this->reallocate(this->new_size(this->size() + count));
+				this->insert_range_in_place(_pos, first, last, count);
+			}
+
+			// The in-place inserts below assume capacity() - size() is
+			// enough, as in ft::vector.
+			void			insert_in_place(size_type _pos, const_reference value)
+			{
+				pointer	pos = this->start + _pos;
+
+				if (pos == this->finish)
+				{
+					this->allocator.construct(this->finish, value);
+					++this->finish;
+					return ;
+				}
+				value_type	copy(value);
+
+				ft::uninitialized_move_if_noexcept(this->finish - 1, this->finish, this->finish);
+				++this->finish;
+				ft::move_backward(pos, this->finish - 2, this->finish - 1);
+				*pos = copy;
+			}
+
+			void			insert_fill_in_place(size_type _pos, size_type count, const_reference value)
+			{
+				if (count == 0) return ;
+
+				value_type	copy(value);
+				pointer		pos = this->start + _pos;
+				size_type	elems_after = this->finish - pos;
+				pointer		old_finish = this->finish;
+
+				if (elems_after > count)
+				{
+					ft::uninitialized_move_if_noexcept(old_finish - count, old_finish, old_finish);
+					this->finish += count;
+					ft::move_backward(pos, old_finish - count, old_finish);
+					ft::fill(pos, pos + count, copy);
+				}
+				else
+				{
+					this->finish = ft::uninitialized_fill_n(old_finish, count - elems_after, copy);
+					this->finish = ft::uninitialized_move_if_noexcept(pos, old_finish, this->finish);
+					ft::fill(pos, old_finish, copy);
+				}
+			}
+
+			template<class ForwardIt>
+			void			insert_range_in_place(size_type _pos, ForwardIt first, ForwardIt last, size_type count)
+			{
+				if (count == 0) return ;
+
+				pointer		pos = this->start + _pos;
+				size_type	elems_after = this->finish - pos;
+				pointer		old_finish = this->finish;
+
+				if (elems_after > count)
+				{
+					ft::uninitialized_move_if_noexcept(old_finish - count, old_finish, old_finish);
+					this->finish += count;
+					ft::move_backward(pos, old_finish - count, old_finish);
+					ft::copy(first, last, pos);
+				}
+				else
+				{
+					ForwardIt	mid = first;
+
+					ft::advance(mid, elems_after);
+					this->finish = ft::uninitialized_copy(mid, last, old_finish);
+					this->finish = ft::uninitialized_move_if_noexcept(pos, old_finish, this->finish);
+					ft::copy(first, mid, pos);
+				}
+			}
+	};
+
+	template<class T, size_t N, class Allocator>
+	bool	operator==(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (a.size() == b.size() && ft::equal(a.begin(), a.end(), b.begin()));
+	}
+
+	template<class T, size_t N, class Allocator>
+	bool	operator!=(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (!(a == b));
+	}
+
+	template<class T, size_t N, class Allocator>
+	bool	operator<(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+	}
+
+	template<class T, size_t N, class Allocator>
+	bool	operator>(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (b < a);
+	}
+
+	template<class T, size_t N, class Allocator>
+	bool	operator<=(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (!(b < a));
+	}
+
+	template<class T, size_t N, class Allocator>
+	bool	operator>=(const ft::small_vector<T, N, Allocator>& a, const ft::small_vector<T, N, Allocator>& b)
+	{
+		return (!(a < b));
+	}
+
+	template<class T, size_t N, class Allocator>
+	void	swap(ft::small_vector<T, N, Allocator>& lhs, ft::small_vector<T, N, Allocator>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+
+	template<class T, size_t N, class Allocator, class Pred>
+	typename ft::small_vector<T, N, Allocator>::size_type	erase_if(ft::small_vector<T, N, Allocator>& c, Pred pred)
+	{
+		typename ft::small_vector<T, N, Allocator>::iterator	last = ft::remove_if(c.begin(), c.end(), pred);
+		typename ft::small_vector<T, N, Allocator>::size_type	count = c.end() - last;
+
+		c.erase(last, c.end());
+		return (count);
+	}
+}
+
+#endif
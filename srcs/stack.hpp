@@ -38,7 +38,7 @@ namespace ft
 
 			stack&	operator=(const stack& other)
 			{
-				if (*this != other)
+				if (this != &other)
 					this->c = other.c;
 				return (*this);
 			}
@@ -0,0 +1,430 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/19 14:03:21 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/19 14:03:21 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_STATIC_MAP_HPP
+# define FT_STATIC_MAP_HPP
+
+#include <memory>
+#include <stdexcept>
+#include "common.hpp"
+#include "iterator.hpp"
+#include "algorithm.hpp"
+#include "pair.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+
+	inline void		__prefetch(const void* p)
+	{
+#if defined(__GNUC__)
+		__builtin_prefetch(p);
+#else
+		(void)p;
+#endif
+	}
+
+	// Drops the trailing one bits of k and the zero bit above them.
+	inline size_t	__strip_right_turns(size_t k)
+	{
+#if defined(__GNUC__)
+		return (k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1));
+#else
+		while (k & 1)
+			k >>= 1;
+		return (k >> 1);
+#endif
+	}
+
+	// In-order walk over an Eytzinger array (slot 0 unused, children of k
+	// at 2k and 2k + 1); slot 0 is also the end() position.
+	template<class T>
+	struct	eytzinger_iterator
+	{
+		typedef T							value_type;
+		typedef const value_type&			reference;
+		typedef const T*					pointer;
+		typedef bidirectional_iterator_tag	iterator_category;
+		typedef ptrdiff_t					difference_type;
+		typedef eytzinger_iterator<T>		self;
+
+		eytzinger_iterator() : base(NULL), slot(0), nodes_count(0) {}
+
+		eytzinger_iterator(pointer base, size_t slot, size_t nodes_count) : base(base), slot(slot), nodes_count(nodes_count) {}
+
+		reference	operator*() const
+		{
+			return (this->base[this->slot]);
+		}
+
+		pointer		operator->() const
+		{
+			return (&this->base[this->slot]);
+		}
+
+		// Leftmost node of the right subtree, else up past the right turns.
+		self&	operator++()
+		{
+			if (2 * this->slot + 1 <= this->nodes_count)
+			{
+				this->slot = 2 * this->slot + 1;
+				while (2 * this->slot <= this->nodes_count)
+					this->slot = 2 * this->slot;
+			}
+			else
+				this->slot = ft::__strip_right_turns(this->slot);
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self	tmp = *this;
+
+			++*this;
+			return (tmp);
+		}
+
+		self&	operator--()
+		{
+			if (this->slot == 0 || 2 * this->slot <= this->nodes_count)
+			{
+				this->slot = this->slot == 0 ? 1 : 2 * this->slot;
+				while (2 * this->slot + 1 <= this->nodes_count)
+					this->slot = 2 * this->slot + 1;
+			}
+			else
+			{
+				while ((this->slot & 1) == 0)
+					this->slot >>= 1;
+				this->slot >>= 1;
+			}
+			return (*this);
+		}
+
+		self	operator--(int)
+		{
+			self	tmp = *this;
+
+			--*this;
+			return (tmp);
+		}
+
+		bool	operator==(const self& x) const
+		{
+			return (this->slot == x.slot);
+		}
+
+		bool	operator!=(const self& x) const
+		{
+			return (this->slot != x.slot);
+		}
+
+		public:
+			pointer	base;
+			size_t	slot;
+			size_t	nodes_count;
+	};
+
+	// Read-only snapshot of a map for lookup-heavy readers. Entries are
+	// laid out in Eytzinger order (the implicit binary tree of a heap) in
+	// one array, so a search walks down contiguous memory: the top levels
+	// stay cached, the next ones are prefetched, the loop has no
+	// unpredictable branch and the slot it ends on is the entry itself.
+	template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class static_map
+	{
+		public:
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef ft::pair<Key, T>												value_type;
+			typedef size_t															size_type;
+			typedef ptrdiff_t														difference_type;
+			typedef Compare															key_compare;
+			typedef typename Allocator::template rebind<value_type>::other			allocator_type;
+			typedef typename allocator_type::const_reference						reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::const_pointer							pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef ft::eytzinger_iterator<value_type>								iterator;
+			typedef ft::eytzinger_iterator<value_type>								const_iterator;
+			typedef ft::reverse_iterator<const_iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+		public:
+			// MEMBERS FUNCTIONS
+			static_map() : entries(), nodes_count(0), comp() {}
+
+			// Sorted input is laid out directly; anything else is sorted and
+			// deduplicated through an ft::map first.
+			template<class InputIt>
+			static_map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : entries(allocator_type(alloc)), nodes_count(0), comp(comp)
+			{
+				this->init(first, last, ft::iterator_category(first));
+			}
+
+			template<class ForwardIt>
+			static_map(ft::sorted_unique_t, ForwardIt first, ForwardIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : entries(allocator_type(alloc)), nodes_count(0), comp(comp)
+			{
+				this->layout(first, ft::distance(first, last));
+			}
+
+			static_map(const static_map& other) : entries(other.entries), nodes_count(other.nodes_count), comp(other.comp) {}
+
+			~static_map() {}
+
+			static_map&	operator=(const static_map& other)
+			{
+				if (this != &other)
+				{
+					this->entries = other.entries;
+					this->nodes_count = other.nodes_count;
+					this->comp = other.comp;
+				}
+				return (*this);
+			}
+
+			allocator_type	get_allocator() const
+			{
+				return (this->entries.get_allocator_type());
+			}
+
+			// ELEMENT ACCESS
+			const T&	at(const key_type& key) const
+			{
+				const_iterator	it = this->find(key);
+
+				if (it == this->end())
+					throw std::out_of_range("static_map::at");
+				return (it->second);
+			}
+
+			// CAPACITY
+			size_type	size() const
+			{
+				return (this->nodes_count);
+			}
+
+			bool		empty() const
+			{
+				return (this->nodes_count == 0);
+			}
+
+			size_type	max_size() const
+			{
+				return (this->entries.max_size() - 1);
+			}
+
+			// ITERATORS
+			const_iterator			begin() const
+			{
+				size_type	k = 1;
+
+				if (this->nodes_count == 0)
+					return (this->end());
+				while (2 * k <= this->nodes_count)
+					k = 2 * k;
+				return (this->at_slot(k));
+			}
+
+			const_iterator			end() const
+			{
+				return (this->at_slot(0));
+			}
+
+			const_reverse_iterator 	rbegin() const
+			{
+				return (const_reverse_iterator(this->end()));
+			}
+
+			const_reverse_iterator 	rend() const
+			{
+				return (const_reverse_iterator(this->begin()));
+			}
+
+			// MODIFIERS
+			void		swap(static_map& other)
+			{
+				this->entries.swap(other.entries);
+				ft::swap(&this->nodes_count, &other.nodes_count);
+				ft::swap(&this->comp, &other.comp);
+			}
+
+			// LOOKUP
+			size_type								count(const key_type& key) const
+			{
+				return (this->find(key) != this->end() ? 1 : 0);
+			}
+
+			const_iterator							find(const key_type& key) const
+			{
+				size_type	k = this->lower_slot(key);
+
+				if (k != 0 && !this->comp(key, this->entries[k].first))
+					return (this->at_slot(k));
+				return (this->end());
+			}
+
+			const_iterator							lower_bound(const key_type& key) const
+			{
+				return (this->at_slot(this->lower_slot(key)));
+			}
+
+			const_iterator							upper_bound(const key_type& key) const
+			{
+				return (this->at_slot(this->upper_slot(key)));
+			}
+
+			ft::pair<const_iterator,const_iterator>	equal_range(const key_type& key) const
+			{
+				return (ft::make_pair<const_iterator, const_iterator>(this->lower_bound(key), this->upper_bound(key)));
+			}
+
+			// OBSERVERS
+			key_compare key_comp() const
+			{
+				return (this->comp);
+			}
+		private:
+			ft::vector<value_type, allocator_type>			entries;
+			size_type										nodes_count;
+			key_compare										comp;
+
+			const_iterator	at_slot(size_type k) const
+			{
+				return (const_iterator(this->entries.data(), k, this->nodes_count));
+			}
+
+			template<class InputIt>
+			void	init(InputIt first, InputIt last, ft::input_iterator_tag)
+			{
+				ft::map<Key, T, Compare, Allocator>	sorted(first, last, this->comp);
+
+				this->layout(sorted.begin(), sorted.size());
+			}
+
+			template<class ForwardIt>
+			void	init(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+			{
+				size_type	size = 0;
+
+				for (ForwardIt prev = first, it = first;it != last;prev = it, ++size)
+				{
+					if (++it != last && !this->comp((*prev).first, (*it).first))
+					{
+						this->init(first, last, ft::input_iterator_tag());
+						return ;
+					}
+				}
+				this->layout(first, size);
+			}
+
+			// Slot 0 is unused so that the root sits at 1. The array is filled
+			// with copies of the first entry, then overwritten by an in-order
+			// walk of the implicit tree.
+			template<class ForwardIt>
+			void	layout(ForwardIt first, size_type size)
+			{
+				if (size == 0)
+					return ;
+				this->entries.assign(size + 1, *first);
+				this->nodes_count = size;
+				this->place(first, 1);
+			}
+
+			template<class ForwardIt>
+			void	place(ForwardIt& it, size_type k)
+			{
+				if (k > this->nodes_count)
+					return ;
+				this->place(it, 2 * k);
+				this->entries[k] = *it;
+				++it;
+				this->place(it, 2 * k + 1);
+			}
+
+			// The comparison result picks the child, so the loop carries no
+			// data-dependent branch. The 16 descendants four levels below k
+			// are contiguous and fetched ahead. Once past a leaf, k spells
+			// the path taken: stripping the final right turns and the left
+			// turn above them yields the last node we went left at, the
+			// lower bound (0, end(), if none).
+			size_type	lower_slot(const key_type& key) const
+			{
+				size_type	n = this->nodes_count;
+				size_type	k = 1;
+
+				while (k <= n)
+				{
+					ft::__prefetch(&this->entries[16 * k <= n ? 16 * k : 0]);
+					k = 2 * k + this->comp(this->entries[k].first, key);
+				}
+				return (ft::__strip_right_turns(k));
+			}
+
+			size_type	upper_slot(const key_type& key) const
+			{
+				size_type	n = this->nodes_count;
+				size_type	k = 1;
+
+				while (k <= n)
+				{
+					ft::__prefetch(&this->entries[16 * k <= n ? 16 * k : 0]);
+					k = 2 * k + !this->comp(key, this->entries[k].first);
+				}
+				return (ft::__strip_right_turns(k));
+			}
+	};
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator==(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator<(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator!=(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator>(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator<=(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	inline bool	operator>=(const ft::static_map<Key, T, Compare, Allocator>& lhs, const ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template<class Key, class T, class Compare, class Allocator>
+	void swap(ft::static_map<Key, T, Compare, Allocator>& lhs, ft::static_map<Key, T, Compare, Allocator>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+};
+
+#endif
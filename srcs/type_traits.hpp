@@ -55,11 +55,19 @@ namespace ft
 	template<>
 	struct __is_integral_helper<char> : public true_type {};
 
+	template<>
+	struct __is_integral_helper<signed char> : public true_type {};
+
+	template<>
+	struct __is_integral_helper<unsigned char> : public true_type {};
+
+#if __cplusplus >= 201103L
 	template<>
 	struct __is_integral_helper<char16_t> : public true_type {};
 
 	template<>
 	struct __is_integral_helper<char32_t> : public true_type {};
+#endif
 
 	template<>
 	struct __is_integral_helper<wchar_t> : public true_type {};
@@ -67,15 +75,27 @@ namespace ft
 	template<>
 	struct __is_integral_helper<short> : public true_type {};
 
+	template<>
+	struct __is_integral_helper<unsigned short> : public true_type {};
+
 	template<>
 	struct __is_integral_helper<int> : public true_type {};
 
+	template<>
+	struct __is_integral_helper<unsigned int> : public true_type {};
+
 	template<>
 	struct __is_integral_helper<long> : public true_type {};
 
+	template<>
+	struct __is_integral_helper<unsigned long> : public true_type {};
+
 	template<>
 	struct __is_integral_helper<long long> : public true_type {};
 
+	template<>
+	struct __is_integral_helper<unsigned long long> : public true_type {};
+
 	template<typename T>
     struct is_integral : public __is_integral_helper<typename remove_cv<T>::type>::type {};
 
@@ -97,6 +117,46 @@ namespace ft
       	typedef typename remove_const<typename remove_volatile<T>::type>::type	type;
     };
 	
+	template<typename>
+	struct __is_floating_point_helper : public false_type {};
+
+	template<>
+	struct __is_floating_point_helper<float> : public true_type {};
+
+	template<>
+	struct __is_floating_point_helper<double> : public true_type {};
+
+	template<>
+	struct __is_floating_point_helper<long double> : public true_type {};
+
+	template<typename T>
+    struct is_floating_point : public __is_floating_point_helper<typename remove_cv<T>::type>::type {};
+
+	template<typename>
+	struct __is_pointer_helper : public false_type {};
+
+	template<typename T>
+	struct __is_pointer_helper<T*> : public true_type {};
+
+	template<typename T>
+    struct is_pointer : public __is_pointer_helper<typename remove_cv<T>::type>::type {};
+
+	template<typename T>
+	struct __is_trivially_copyable_helper
+	{
+		static const bool value = is_integral<T>::value || is_floating_point<T>::value || is_pointer<T>::value;
+	};
+
+	// Types that may be copied with memcpy/memmove. Arithmetic and pointer
+	// types are detected; specialize it for your own POD types to opt in.
+	template<typename T>
+	struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable_helper<typename remove_cv<T>::type>::value> {};
+
+	// Types whose destructor may be skipped; trivially copyable types
+	// qualify by default.
+	template<typename T>
+	struct is_trivially_destructible : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
 	template<class T, class U>
 	struct are_same
 	{
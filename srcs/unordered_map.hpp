@@ -0,0 +1,782 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kmazier <kmazier@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/12/21 11:26:50 by kmazier           #+#    #+#             */
+/*   Updated: 2021/12/21 11:26:50 by kmazier          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_UNORDERED_MAP_HPP
+# define FT_UNORDERED_MAP_HPP
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include "common.hpp"
+#include "iterator.hpp"
+#include "pair.hpp"
+#include "hash.hpp"
+
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+namespace ft
+{
+
+	// One control byte per slot: the low 7 bits of the hash for a full
+	// slot, otherwise one of these. The sentinel sits past the last slot
+	// and stops iteration.
+	enum hash_ctrl
+	{
+		hash_ctrl_empty = -128,
+		hash_ctrl_deleted = -2,
+		hash_ctrl_sentinel = -1
+	};
+
+	template<typename T>
+	struct	hash_table_iterator
+	{
+		typedef T							value_type;
+		typedef value_type&					reference;
+		typedef T*							pointer;
+		typedef forward_iterator_tag		iterator_category;
+		typedef ptrdiff_t					difference_type;
+		typedef hash_table_iterator<T>		self;
+
+		hash_table_iterator() : ctrl(NULL), slot(NULL) {}
+
+		hash_table_iterator(const signed char* ctrl, pointer slot) : ctrl(ctrl), slot(slot) {}
+
+		reference	operator*() const
+		{
+			return (*this->slot);
+		}
+
+		pointer		operator->() const
+		{
+			return (this->slot);
+		}
+
+		self&	operator++()
+		{
+			++this->ctrl;
+			++this->slot;
+			this->skip_free();
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self	tmp = *this;
+
+			++*this;
+			return (tmp);
+		}
+
+		// Moves past empty and deleted slots; stops on the sentinel.
+		void	skip_free()
+		{
+			while (*this->ctrl < hash_ctrl_sentinel)
+			{
+				++this->ctrl;
+				++this->slot;
+			}
+		}
+
+		bool	operator==(const self& x) const
+		{
+			return (this->slot == x.slot);
+		}
+
+		bool	operator!=(const self& x) const
+		{
+			return (this->slot != x.slot);
+		}
+
+		public:
+			const signed char*	ctrl;
+			pointer				slot;
+	};
+
+	template<typename T>
+	struct	hash_table_const_iterator
+	{
+		typedef T							value_type;
+		typedef const value_type&			reference;
+		typedef const T*					pointer;
+		typedef forward_iterator_tag		iterator_category;
+		typedef hash_table_iterator<T>		iterator;
+		typedef ptrdiff_t					difference_type;
+		typedef hash_table_const_iterator<T>	self;
+
+		hash_table_const_iterator() : ctrl(NULL), slot(NULL) {}
+
+		hash_table_const_iterator(const signed char* ctrl, pointer slot) : ctrl(ctrl), slot(slot) {}
+
+		hash_table_const_iterator(const iterator& src) : ctrl(src.ctrl), slot(src.slot) {}
+
+		reference	operator*() const
+		{
+			return (*this->slot);
+		}
+
+		pointer		operator->() const
+		{
+			return (this->slot);
+		}
+
+		self&	operator++()
+		{
+			++this->ctrl;
+			++this->slot;
+			this->skip_free();
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self	tmp = *this;
+
+			++*this;
+			return (tmp);
+		}
+
+		void	skip_free()
+		{
+			while (*this->ctrl < hash_ctrl_sentinel)
+			{
+				++this->ctrl;
+				++this->slot;
+			}
+		}
+
+		bool	operator==(const self& x) const
+		{
+			return (this->slot == x.slot);
+		}
+
+		bool	operator!=(const self& x) const
+		{
+			return (this->slot != x.slot);
+		}
+
+		public:
+			const signed char*	ctrl;
+			pointer				slot;
+	};
+
+	// Open-addressing hash map: entries sit directly in a power-of-two
+	// slot array, probed linearly, next to a parallel array of control
+	// bytes (SwissTable-style). A probe compares the 7-bit hash stored in
+	// the control byte before touching the entry, so mismatches rarely
+	// cost a key comparison, and a lookup is a scan over contiguous
+	// memory instead of a walk down a tree.
+	//
+	// Erasing leaves a tombstone unless the next slot is empty, so erase
+	// never moves other entries: iterators stay valid except across a
+	// rehash. Unlike std::unordered_map, a rehash (growing on insert,
+	// rehash, reserve) also moves the entries themselves.
+	template<class Key, class T, class Hash = ft::hash<Key>, class KeyEqual = ft::equal_to<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class unordered_map
+	{
+		public:
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef ft::pair<Key, T>												value_type;
+			typedef size_t															size_type;
+			typedef ptrdiff_t														difference_type;
+			typedef Hash															hasher;
+			typedef KeyEqual														key_equal;
+			typedef typename Allocator::template rebind<value_type>::other			allocator_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef ft::hash_table_iterator<value_type>								iterator;
+			typedef ft::hash_table_const_iterator<value_type>						const_iterator;
+		private:
+			typedef typename Allocator::template rebind<signed char>::other			ctrl_allocator_type;
+		public:
+			// MEMBERS FUNCTIONS
+			unordered_map() : ctrl(empty_ctrl()), slots(NULL), slot_count(0), nodes_count(0), deleted_count(0), max_load(0.875f), hash_func(), equal_func(), allocator(), ctrl_allocator() {}
+
+			explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: ctrl(empty_ctrl()), slots(NULL), slot_count(0), nodes_count(0), deleted_count(0), max_load(0.875f), hash_func(hash), equal_func(equal), allocator(alloc), ctrl_allocator(alloc)
+			{
+				this->rehash(bucket_count);
+			}
+
+			template<class InputIt>
+			unordered_map(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: ctrl(empty_ctrl()), slots(NULL), slot_count(0), nodes_count(0), deleted_count(0), max_load(0.875f), hash_func(hash), equal_func(equal), allocator(alloc), ctrl_allocator(alloc)
+			{
+				this->rehash(bucket_count);
+				this->insert(first, last);
+			}
+
+			unordered_map(const unordered_map& other)
+				: ctrl(empty_ctrl()), slots(NULL), slot_count(0), nodes_count(0), deleted_count(0), max_load(other.max_load), hash_func(other.hash_func), equal_func(other.equal_func), allocator(other.allocator), ctrl_allocator(other.ctrl_allocator)
+			{
+				this->copy(other);
+			}
+
+			~unordered_map()
+			{
+				this->release();
+			}
+
+			unordered_map&	operator=(const unordered_map& other)
+			{
+				if (this != &other)
+				{
+					unordered_map	tmp(other);
+
+					this->swap(tmp);
+				}
+				return (*this);
+			}
+
+			allocator_type	get_allocator() const
+			{
+				return (this->allocator);
+			}
+
+			// ELEMENT ACCESS
+			T&			at(const key_type& key)
+			{
+				size_type	i = this->find_index(key, this->hash_key(key));
+
+				if (i == this->slot_count)
+					throw std::out_of_range("unordered_map::at");
+				return (this->slots[i].second);
+			}
+
+			const T&	at(const key_type& key) const
+			{
+				size_type	i = this->find_index(key, this->hash_key(key));
+
+				if (i == this->slot_count)
+					throw std::out_of_range("unordered_map::at");
+				return (this->slots[i].second);
+			}
+
+			T&			operator[](const key_type& key)
+			{
+				size_t		h = this->hash_key(key);
+				size_type	i = this->find_index(key, h);
+
+				if (i == this->slot_count)
+					i = this->insert_new(h, value_type(key, T()));
+				return (this->slots[i].second);
+			}
+
+			// CAPACITY
+			size_type	size() const
+			{
+				return (this->nodes_count);
+			}
+
+			bool		empty() const
+			{
+				return (this->nodes_count == 0);
+			}
+
+			size_type	max_size() const
+			{
+				return (this->allocator.max_size());
+			}
+
+			// ITERATORS
+			iterator		begin()
+			{
+				iterator	it(this->ctrl, this->slots);
+
+				it.skip_free();
+				return (it);
+			}
+
+			const_iterator	begin() const
+			{
+				const_iterator	it(this->ctrl, this->slots);
+
+				it.skip_free();
+				return (it);
+			}
+
+			iterator		end()
+			{
+				return (iterator(this->ctrl + this->slot_count, this->slots + this->slot_count));
+			}
+
+			const_iterator	end() const
+			{
+				return (const_iterator(this->ctrl + this->slot_count, this->slots + this->slot_count));
+			}
+
+			// MODIFIERS
+			void						clear()
+			{
+				for (size_type i = 0;i < this->slot_count;i++)
+				{
+					if (this->ctrl[i] >= 0)
+						this->allocator.destroy(this->slots + i);
+					this->ctrl[i] = hash_ctrl_empty;
+				}
+				this->nodes_count = 0;
+				this->deleted_count = 0;
+			}
+
+			ft::pair<iterator, bool>	insert(const value_type& value)
+			{
+				size_t		h = this->hash_key(value.first);
+				size_type	i = this->find_index(value.first, h);
+
+				if (i != this->slot_count)
+					return (ft::make_pair<iterator, bool>(this->iterator_at(i), false));
+				return (ft::make_pair<iterator, bool>(this->iterator_at(this->insert_new(h, value)), true));
+			}
+
+			iterator					insert(iterator, const value_type& value)
+			{
+				return (this->insert(value).first);
+			}
+
+			template<class InputIt>
+			void						insert(InputIt first, InputIt last)
+			{
+				for (;first != last;++first)
+					this->insert(*first);
+			}
+
+			iterator					erase(iterator pos)
+			{
+				size_type	i = pos.slot - this->slots;
+				iterator	next(this->ctrl + i, this->slots + i);
+
+				this->erase_at(i);
+				next.skip_free();
+				return (next);
+			}
+
+			iterator					erase(iterator first, iterator last)
+			{
+				while (first != last)
+					first = this->erase(first);
+				return (last);
+			}
+
+			size_type					erase(const key_type& key)
+			{
+				size_type	i = this->find_index(key, this->hash_key(key));
+
+				if (i == this->slot_count)
+					return (0);
+				this->erase_at(i);
+				return (1);
+			}
+
+			void						swap(unordered_map& other)
+			{
+				ft::swap(&this->ctrl, &other.ctrl);
+				ft::swap(&this->slots, &other.slots);
+				ft::swap(&this->slot_count, &other.slot_count);
+				ft::swap(&this->nodes_count, &other.nodes_count);
+				ft::swap(&this->deleted_count, &other.deleted_count);
+				ft::swap(&this->max_load, &other.max_load);
+				ft::swap(&this->hash_func, &other.hash_func);
+				ft::swap(&this->equal_func, &other.equal_func);
+				ft::swap(&this->allocator, &other.allocator);
+				ft::swap(&this->ctrl_allocator, &other.ctrl_allocator);
+			}
+
+			// LOOKUP
+			size_type								count(const key_type& key) const
+			{
+				return (this->find_index(key, this->hash_key(key)) != this->slot_count ? 1 : 0);
+			}
+
+			iterator								find(const key_type& key)
+			{
+				return (this->iterator_at(this->find_index(key, this->hash_key(key))));
+			}
+
+			const_iterator							find(const key_type& key) const
+			{
+				size_type	i = this->find_index(key, this->hash_key(key));
+
+				return (const_iterator(this->ctrl + i, this->slots + i));
+			}
+
+			ft::pair<iterator,iterator>				equal_range(const key_type& key)
+			{
+				iterator	first = this->find(key);
+				iterator	last = first;
+
+				if (first != this->end())
+					++last;
+				return (ft::make_pair<iterator, iterator>(first, last));
+			}
+
+			ft::pair<const_iterator,const_iterator>	equal_range(const key_type& key) const
+			{
+				const_iterator	first = this->find(key);
+				const_iterator	last = first;
+
+				if (first != this->end())
+					++last;
+				return (ft::make_pair<const_iterator, const_iterator>(first, last));
+			}
+
+			// HASH POLICY
+			size_type	bucket_count() const
+			{
+				return (this->slot_count);
+			}
+
+			float		load_factor() const
+			{
+				if (this->slot_count == 0)
+					return (0.0f);
+				return (static_cast<float>(this->nodes_count) / this->slot_count);
+			}
+
+			float		max_load_factor() const
+			{
+				return (this->max_load);
+			}
+
+			// Open addressing needs a free slot to end every probe, so the
+			// ratio is kept within [0.25, 0.9375].
+			void		max_load_factor(float ml)
+			{
+				if (ml < 0.25f)
+					ml = 0.25f;
+				if (ml > 0.9375f)
+					ml = 0.9375f;
+				this->max_load = ml;
+				if (this->nodes_count + this->deleted_count > this->slot_count * this->max_load)
+					this->rehash(0);
+			}
+
+			// Rebuilds into the smallest power of two slots that is at least
+			// count and keeps the load under max_load_factor(); tombstones
+			// are dropped on the way. Throws length_error past max_slots().
+			void		rehash(size_type count)
+			{
+				size_type	needed = this->slots_for(this->nodes_count);
+				size_type	capacity = 8;
+
+				if (count > this->max_slots())
+					throw std::length_error("unordered_map::rehash");
+				if (count < needed)
+					count = needed;
+				if (count == 0)
+				{
+					if (this->slot_count == 0)
+						return ;
+					count = 1;
+				}
+				while (capacity < count)
+					capacity *= 2;
+				if (capacity != this->slot_count || this->deleted_count != 0)
+					this->resize(capacity);
+			}
+
+			void		reserve(size_type count)
+			{
+				this->rehash(this->slots_for(count));
+			}
+
+			// OBSERVERS
+			hasher		hash_function() const
+			{
+				return (this->hash_func);
+			}
+
+			key_equal	key_eq() const
+			{
+				return (this->equal_func);
+			}
+		private:
+			signed char*			ctrl;
+			pointer					slots;
+			size_type				slot_count;
+			size_type				nodes_count;
+			size_type				deleted_count;
+			float					max_load;
+			hasher					hash_func;
+			key_equal				equal_func;
+			allocator_type			allocator;
+			ctrl_allocator_type		ctrl_allocator;
+
+			// Control bytes of a table with no slot: just the sentinel.
+			static signed char*	empty_ctrl()
+			{
+				static signed char	sentinel = hash_ctrl_sentinel;
+
+				return (&sentinel);
+			}
+
+			// Fibonacci scrambling, so identity hashes of nearby integers
+			// spread over the whole table; the upper half is folded into
+			// the lower bits used for the slot and the control byte.
+			size_t		hash_key(const key_type& key) const
+			{
+				const size_t	golden = (static_cast<size_t>(0x9E3779B9UL) << 16 << 16) | 0x7F4A7C15UL;
+				size_t			h = this->hash_func(key) * golden;
+
+				return (h ^ (h >> (sizeof(size_t) * 4)));
+			}
+
+			// Largest power of two slot count the allocator can provide.
+			size_type	max_slots() const
+			{
+				size_type	limit = this->max_size();
+				size_type	slots = 1;
+
+				while (slots <= limit / 2)
+					slots *= 2;
+				return (slots);
+			}
+
+			// Checked in floating point first: the slot count for a huge
+			// count may not fit in size_type.
+			size_type	slots_for(size_type count) const
+			{
+				if (count == 0)
+					return (0);
+
+				float	slots = count / this->max_load;
+
+				if (slots >= static_cast<float>(this->max_slots()))
+					throw std::length_error("unordered_map: max_size exceeded");
+				return (static_cast<size_type>(slots) + 1);
+			}
+
+			iterator	iterator_at(size_type i)
+			{
+				return (iterator(this->ctrl + i, this->slots + i));
+			}
+
+			// Returns slot_count (the end() index) when key is absent. The
+			// load cap guarantees an empty slot ends every probe.
+			size_type	find_index(const key_type& key, size_t h) const
+			{
+				if (this->slot_count == 0)
+					return (0);
+
+				size_type	mask = this->slot_count - 1;
+				size_type	i = (h >> 7) & mask;
+				signed char	tag = static_cast<signed char>(h & 0x7F);
+
+				while (true)
+				{
+					signed char	c = this->ctrl[i];
+
+					if (c == tag && this->equal_func(this->slots[i].first, key))
+						return (i);
+					if (c == hash_ctrl_empty)
+						return (this->slot_count);
+					i = (i + 1) & mask;
+				}
+			}
+
+			// First empty or deleted slot on h's probe sequence.
+			size_type	free_index(size_t h) const
+			{
+				size_type	mask = this->slot_count - 1;
+				size_type	i = (h >> 7) & mask;
+
+				while (this->ctrl[i] >= 0)
+					i = (i + 1) & mask;
+				return (i);
+			}
+
+			// The caller has checked that the key is absent. Grows first if
+			// the new entry would cross the load cap (tombstones included).
+			size_type	insert_new(size_t h, const value_type& value)
+			{
+				if (this->nodes_count + this->deleted_count + 1 > this->slot_count * this->max_load)
+				{
+					size_type	needed = this->slots_for(this->nodes_count + 1);
+
+					this->rehash(needed > this->slot_count ? needed : this->slot_count);
+				}
+
+				size_type	i = this->free_index(h);
+
+				this->allocator.construct(this->slots + i, value);
+				if (this->ctrl[i] == hash_ctrl_deleted)
+					this->deleted_count--;
+				this->ctrl[i] = static_cast<signed char>(h & 0x7F);
+				this->nodes_count++;
+				return (i);
+			}
+
+			// A slot followed by an empty one ends no probe sequence that
+			// could continue past it, so it can go back to empty.
+			void		erase_at(size_type i)
+			{
+				this->allocator.destroy(this->slots + i);
+				if (this->ctrl[(i + 1) & (this->slot_count - 1)] == hash_ctrl_empty)
+					this->ctrl[i] = hash_ctrl_empty;
+				else
+				{
+					this->ctrl[i] = hash_ctrl_deleted;
+					this->deleted_count++;
+				}
+				this->nodes_count--;
+			}
+
+			void		allocate(size_type capacity, signed char*& new_ctrl, pointer& new_slots)
+			{
+				new_ctrl = this->ctrl_allocator.allocate(capacity + 1);
+				try
+				{
+					new_slots = this->allocator.allocate(capacity);
+				}
+				catch (...)
+				{
+					this->ctrl_allocator.deallocate(new_ctrl, capacity + 1);
+					throw ;
+				}
+				for (size_type i = 0;i < capacity;i++)
+					new_ctrl[i] = hash_ctrl_empty;
+				new_ctrl[capacity] = hash_ctrl_sentinel;
+			}
+
+			void		deallocate(signed char* old_ctrl, pointer old_slots, size_type capacity)
+			{
+				for (size_type i = 0;i < capacity;i++)
+					if (old_ctrl[i] >= 0)
+						this->allocator.destroy(old_slots + i);
+				this->allocator.deallocate(old_slots, capacity);
+				this->ctrl_allocator.deallocate(old_ctrl, capacity + 1);
+			}
+
+			// Entries are rehashed into fresh arrays; the old ones are only
+			// released once every entry made it, so a throwing copy leaves
+			// the table untouched.
+			void		resize(size_type capacity)
+			{
+				signed char*	new_ctrl;
+				pointer			new_slots;
+				size_type		mask = capacity - 1;
+
+				this->allocate(capacity, new_ctrl, new_slots);
+				try
+				{
+					for (size_type j = 0;j < this->slot_count;j++)
+					{
+						if (this->ctrl[j] < 0)
+							continue ;
+
+						size_t		h = this->hash_key(this->slots[j].first);
+						size_type	i = (h >> 7) & mask;
+
+						while (new_ctrl[i] >= 0)
+							i = (i + 1) & mask;
+#if __cplusplus >= 201103L
+						::new (static_cast<void*>(new_slots + i)) value_type(std::move_if_noexcept(this->slots[j]));
+#else
+						this->allocator.construct(new_slots + i, this->slots[j]);
+#endif
+						new_ctrl[i] = static_cast<signed char>(h & 0x7F);
+					}
+				}
+				catch (...)
+				{
+					this->deallocate(new_ctrl, new_slots, capacity);
+					throw ;
+				}
+				if (this->slot_count != 0)
+					this->deallocate(this->ctrl, this->slots, this->slot_count);
+				this->ctrl = new_ctrl;
+				this->slots = new_slots;
+				this->slot_count = capacity;
+				this->deleted_count = 0;
+			}
+
+			// Slot-for-slot copy of other's arrays, tombstones included.
+			void		copy(const unordered_map& other)
+			{
+				if (other.slot_count == 0)
+					return ;
+
+				signed char*	new_ctrl;
+				pointer			new_slots;
+				size_type		i = 0;
+
+				this->allocate(other.slot_count, new_ctrl, new_slots);
+				try
+				{
+					for (;i < other.slot_count;i++)
+						if (other.ctrl[i] >= 0)
+							this->allocator.construct(new_slots + i, other.slots[i]);
+				}
+				catch (...)
+				{
+					for (size_type j = 0;j < i;j++)
+						if (other.ctrl[j] >= 0)
+							this->allocator.destroy(new_slots + j);
+					this->allocator.deallocate(new_slots, other.slot_count);
+					this->ctrl_allocator.deallocate(new_ctrl, other.slot_count + 1);
+					throw ;
+				}
+				for (i = 0;i <= other.slot_count;i++)
+					new_ctrl[i] = other.ctrl[i];
+				this->ctrl = new_ctrl;
+				this->slots = new_slots;
+				this->slot_count = other.slot_count;
+				this->nodes_count = other.nodes_count;
+				this->deleted_count = other.deleted_count;
+			}
+
+			void		release()
+			{
+				if (this->slot_count != 0)
+					this->deallocate(this->ctrl, this->slots, this->slot_count);
+				this->ctrl = empty_ctrl();
+				this->slots = NULL;
+				this->slot_count = 0;
+				this->nodes_count = 0;
+				this->deleted_count = 0;
+			}
+	};
+
+	template<class Key, class T, class Hash, class KeyEqual, class Allocator>
+	bool	operator==(const ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs, const ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
+	{
+		typedef typename ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator	const_iterator;
+
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (const_iterator it = lhs.begin();it != lhs.end();++it)
+		{
+			const_iterator	found = rhs.find(it->first);
+
+			if (found == rhs.end() || !(found->second == it->second))
+				return (false);
+		}
+		return (true);
+	}
+
+	template<class Key, class T, class Hash, class KeyEqual, class Allocator>
+	bool	operator!=(const ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs, const ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class Key, class T, class Hash, class KeyEqual, class Allocator>
+	void	swap(ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& lhs, ft::unordered_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
@@ -20,10 +20,16 @@
 #include "algorithm.hpp"
 #include "type_traits.hpp"
 #include "common.hpp"
+#include "growth_policy.hpp"
+
+#if __cplusplus >= 201103L
+# include <utility>
+# include <algorithm>
+#endif
 
 namespace ft
 {
-	template<class T, class Allocator = std::allocator<T> >
+	template<class T, class Allocator = std::allocator<T>, class Growth = ft::double_growth>
 	class	vector
 	{
 		public:
@@ -63,6 +69,15 @@ namespace ft
 				this->copy_init(other);
 			}
 
+#if __cplusplus >= 201103L
+			vector(vector&& other) noexcept : start(other.start), finish(other.finish), end_of_storage(other.end_of_storage), allocator(std::move(other.allocator))
+			{
+				other.start = pointer();
+				other.finish = pointer();
+				other.end_of_storage = pointer();
+			}
+#endif
+
 			~vector(void)
 			{
 				this->delete_storage();
@@ -73,12 +88,31 @@ namespace ft
 				return (this->allocator);
 			}
 
+			// Reuses the buffer when other fits in it: live elements are
+			// assigned over, the rest is constructed or destroyed.
 			vector	&		operator=(const vector &other)
 			{
-				if (*this != other)
-					this->copy(other);
+				if (this != &other)
+					this->assign_range(other.start, other.finish, ft::forward_iterator_tag());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			vector	&		operator=(vector &&other) noexcept
+			{
+				if (this != &other)
+				{
+					this->delete_storage();
+					this->start = other.start;
+					this->finish = other.finish;
+					this->end_of_storage = other.end_of_storage;
+					other.start = pointer();
+					other.finish = pointer();
+					other.end_of_storage = pointer();
+				}
 				return (*this);
 			}
+#endif
 
 			void			assign(size_type count, const_reference value) 
 			{
@@ -237,6 +271,51 @@ namespace ft
 					this->realloc_insert(end(), value);
 			}
 
+#if __cplusplus >= 201103L
+			void				push_back(value_type &&value)
+			{
+				this->emplace_back(std::move(value));
+			}
+
+			template<class... Args>
+			void				emplace_back(Args&&... args)
+			{
+				if (this->finish != this->end_of_storage)
+				{
+					::new (static_cast<void*>(this->finish)) value_type(std::forward<Args>(args)...);
+					this->finish++;
+				}
+				else
+					this->realloc_emplace(end(), std::forward<Args>(args)...);
+			}
+
+			// The new element is built before anything is shifted, so args
+			// may refer to elements of this vector.
+			template<class... Args>
+			iterator			emplace(const_iterator pos, Args&&... args)
+			{
+				size_type	_pos = pos - const_iterator(this->start);
+
+				if (this->finish == this->end_of_storage)
+					return (this->realloc_emplace(this->begin() + _pos, std::forward<Args>(args)...));
+				if (this->start + _pos == this->finish)
+				{
+					::new (static_cast<void*>(this->finish)) value_type(std::forward<Args>(args)...);
+					++this->finish;
+				}
+				else
+				{
+					value_type	tmp(std::forward<Args>(args)...);
+
+					::new (static_cast<void*>(this->finish)) value_type(std::move(*(this->finish - 1)));
+					++this->finish;
+					std::move_backward(this->start + _pos, this->finish - 2, this->finish - 1);
+					*(this->start + _pos) = std::move(tmp);
+				}
+				return (this->begin() + _pos);
+			}
+#endif
+
 			void				pop_back()
 			{
 				--this->finish;
@@ -245,7 +324,12 @@ namespace ft
 
 			iterator			insert(iterator pos, const T &value)
 			{
-				return (this->realloc_insert(pos, value));
+				if (this->finish == this->end_of_storage)
+					return (this->realloc_insert(pos, value));
+				size_type	_pos = pos - this->begin();
+
+				this->insert_in_place(pos, value);
+				return (this->begin() + _pos);
 			}
 
 			void				insert(iterator pos, size_type amount, const_reference value)
@@ -271,18 +355,45 @@ namespace ft
 				return (this->_erase_range(first, last));
 			}
 
+			// Erases pos by moving the last element into its place: O(1), but
+			// the order of the elements is not kept.
+			iterator			swap_and_pop(iterator pos)
+			{
+				if (pos.base() != this->finish - 1)
+					ft::__move_assign(*pos, *(this->finish - 1));
+				this->pop_back();
+				return (pos);
+			}
+
 			void			resize(size_type count, value_type value = value_type())
 			{
 				if (count < this->size())
 					this->erase_at_end(&*(this->begin() + count));
 				else if (count > this->size())
-					this->realloc_resize_fill(count, value);
+					this->insert_dispatch(this->end(), count - this->size(), value, true_type());
 			}
 
+			// Exchanges the buffers: O(1), whatever the contents.
 			void			swap(vector &other)
 			{
-				if (*this != other)
-					this->_swap(other);
+				this->_swap(other);
+			}
+
+			// Reallocates to exactly size() elements, freeing the buffer
+			// altogether when the vector is empty.
+			void			shrink_to_fit(void)
+			{
+				if (this->capacity() == this->size())
+					return ;
+				if (this->empty())
+				{
+					this->deallocate(this->start, this->capacity());
+					this->start = pointer();
+					this->finish = pointer();
+					this->end_of_storage = pointer();
+					return ;
+				}
+				this->realloc_reserve(this->size());
 			}
 			private:
 				pointer 		start;
@@ -291,49 +402,54 @@ namespace ft
 				allocator_type	allocator;
 
 				
-				void	create_storage(size_type size)
+				// Leaves the vector empty, with no buffer.
+				void	init_storage()
 				{
-					this->start = this->allocator.allocate(size);
-					this->finish = this->start;
-					this->end_of_storage = this->start + size;
+					this->start = pointer();
+					this->finish = pointer();
+					this->end_of_storage = pointer();
 				}
 				
 				void	copy_init(const vector &other)
 				{
-					this->create_storage(other.size());
-					for (size_type i = 0;i < other.size();i++)
-						this->allocator.construct(this->finish++, other[i]);
+					this->init_storage();
+					this->rebuild(other.size(), range_builder<const_pointer>(other.start, other.finish));
 				}
 
-				void	copy(const vector &other)
+				void	create_storage(size_type size, const_reference value, true_type)
 				{
-					pointer 	_start(this->allocator.allocate(other.size()));
-					pointer 	_finish(_start);
-
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(other.begin(), other.end(), _start);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _finish;
+					this->init_storage();
+					this->rebuild(size, fill_builder(size, value));
 				}
-				
-				void	create_storage(size_type size, value_type value, true_type)
+
+				template<class InputIt>
+				void	create_storage(InputIt first, InputIt last, false_type)
 				{
-					this->start = this->allocator.allocate(size);
-					for (size_type i = 0;i < size;i++)
-						this->allocator.construct(this->start + i, value);
-					this->finish = this->start + size;
-					this->end_of_storage = this->start + size;
+					this->range_init(first, last, ft::iterator_category(first));
 				}
 
+				// A pure input range can only be read once: grow as it comes.
 				template<class InputIt>
-				void	create_storage(InputIt first, InputIt last, false_type)
+				void	range_init(InputIt first, InputIt last, ft::input_iterator_tag)
+				{
+					this->init_storage();
+					try
+					{
+						for (;first != last;++first)
+							this->push_back(*first);
+					}
+					catch (...)
+					{
+						this->delete_storage();
+						throw ;
+					}
+				}
+
+				template<class ForwardIt>
+				void	range_init(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
 				{
-					this->create_storage(ft::iter_size(first, last));
-					for (InputIt it = first;it != last;it++)
-						this->allocator.construct(this->finish++, *it);
+					this->init_storage();
+					this->rebuild(ft::distance(first, last), range_builder<ForwardIt>(first, last));
 				}
 
 				void	delete_storage()
@@ -354,65 +470,274 @@ namespace ft
 					this->finish = pos;
 				}
 
-				size_t	new_size()
+				// Every growing reallocation asks the Growth policy, from the
+				// current size, for a capacity of at least n.
+				size_t	new_size(size_t n, size_t size)
 				{
-					size_t size = this->size();
+					if (n > this->max_size())
+						throw std::length_error("vector: max_size exceeded");
 
-					return (size == 0 ? 1 : size * 2);
+					size_t capacity = Growth::next_capacity(size, n, sizeof(value_type));
+
+					return (capacity > this->max_size() ? this->max_size() : capacity);
 				}
 
 				size_t	new_size(size_t n)
 				{
-					size_t size = this->size();
-					
-					if (this->capacity() >= n)
-						return (this->capacity());
-					return (n < size * 2 ? size * 2 : n);
+					return (this->new_size(n, this->size()));
 				}
 
-				void	realloc_reserve(size_type count)
+				size_t	new_size()
 				{
-					pointer		_start(this->allocator.allocate(count));
-					pointer		_finish(_start);
+					return (this->new_size(this->size() + 1));
+				}
 
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(this->start, this->finish, _start);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _start + count;
+				// REALLOCATION
+				//
+				// A realloc_guard owns a buffer while the new contents are built
+				// into it. Built elements are tracked as a front part and a back
+				// part, because inserts construct the new elements first, then
+				// relocate the old ones around them. If anything throws, the
+				// guard destroys what was built and frees the buffer: the vector
+				// itself is untouched until commit().
+				struct	realloc_guard
+				{
+					vector&		owner;
+					size_type	capacity;
+					pointer		start;
+					pointer		front_end;
+					pointer		back_start;
+					pointer		back_end;
+
+					realloc_guard(vector& _owner, size_type _capacity) : owner(_owner), capacity(_capacity), start(_owner.allocator.allocate(_capacity)), front_end(start), back_start(start), back_end(start) {}
+
+					~realloc_guard()
+					{
+						if (this->start == pointer())
+							return ;
+						this->owner.destroy_it(this->start, this->front_end);
+						this->owner.destroy_it(this->back_start, this->back_end);
+						this->owner.allocator.deallocate(this->start, this->capacity);
+					}
+				};
+
+				// Builders construct the new elements at p and return their end.
+				struct	no_builder
+				{
+					pointer	operator()(pointer p) const
+					{
+						return (p);
+					}
+				};
+
+				struct	fill_builder
+				{
+					size_type		count;
+					const_reference	value;
+
+					fill_builder(size_type _count, const_reference _value) : count(_count), value(_value) {}
+
+					pointer	operator()(pointer p) const
+					{
+						return (ft::uninitialized_fill_n(p, this->count, this->value));
+					}
+				};
+
+				template<class ForwardIt>
+				struct	range_builder
+				{
+					ForwardIt	first;
+					ForwardIt	last;
+
+					range_builder(ForwardIt _first, ForwardIt _last) : first(_first), last(_last) {}
+
+					pointer	operator()(pointer p) const
+					{
+						return (ft::uninitialized_copy(this->first, this->last, p));
+					}
+				};
+
+#if __cplusplus >= 201103L
+				struct	move_builder
+				{
+					value_type&	value;
+
+					move_builder(value_type& _value) : value(_value) {}
+
+					pointer	operator()(pointer p) const
+					{
+						::new (static_cast<void*>(p)) value_type(std::move(this->value));
+						return (p + 1);
+					}
+				};
+#endif
+
+				// Swaps the guarded buffer in and releases the old one.
+				void	commit(realloc_guard& guard)
+				{
+					this->delete_storage();
+					this->start = guard.start;
+					this->finish = guard.back_end;
+					this->end_of_storage = guard.start + guard.capacity;
+					guard.start = pointer();
+				}
+
+				// Moves to a buffer of the given capacity, with the elements
+				// made by build inserted at pos. They are built before the old
+				// elements are relocated, so they may be copies of them. Strong
+				// guarantee: relocation only moves when that cannot throw.
+				template<class Builder>
+				iterator	reallocate(size_type capacity, pointer pos, Builder build)
+				{
+					size_type		_pos = pos - this->start;
+					realloc_guard	guard(*this, capacity);
+
+					guard.back_start = guard.start + _pos;
+					guard.back_end = guard.back_start;
+					guard.back_end = build(guard.back_start);
+					guard.front_end = ft::uninitialized_move_if_noexcept(this->start, pos, guard.start);
+					guard.back_end = ft::uninitialized_move_if_noexcept(pos, this->finish, guard.back_end);
+					this->commit(guard);
+					return (this->begin() + _pos);
+				}
+
+				// Replaces the contents with what build makes, in a new buffer.
+				template<class Builder>
+				void	rebuild(size_type capacity, Builder build)
+				{
+					realloc_guard	guard(*this, capacity);
+
+					guard.back_end = build(guard.start);
+					this->commit(guard);
+				}
+
+				void	realloc_reserve(size_type count)
+				{
+					this->reallocate(count, this->finish, no_builder());
 				}
 
 				iterator	realloc_insert(iterator pos, const_reference value)
 				{
-					size_type	size = new_size();
-					size_type	_pos = pos - this->begin();
-					pointer		_start(this->allocator.allocate(size));
-					pointer		_finish(_start);
+					return (this->reallocate(this->new_size(), pos.base(), fill_builder(1, value)));
+				}
 
-					this->allocator.construct(_start + _pos, value);
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(this->start, pos.base(), _start);
-					++_finish;
-					_finish = ft::uninitialized_copy(pos.base(), this->finish, _finish);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _start + size;
-					return (this->begin() + _pos);
+#if __cplusplus >= 201103L
+				template<class... Args>
+				iterator	realloc_emplace(iterator pos, Args&&... args)
+				{
+					value_type	tmp(std::forward<Args>(args)...);
+
+					return (this->reallocate(this->new_size(), pos.base(), move_builder(tmp)));
 				}
+#endif
 
 				template<class InputIt>
 				void	insert_dispatch(iterator pos, InputIt first, InputIt last, false_type)
 				{
-					this->realloc_insert_range(pos, first, last);
+					this->insert_range(pos, first, last, ft::iterator_category(first));
+				}
+
+				// Input ranges are appended as they are read, or buffered once
+				// when they land in the middle.
+				template<class InputIt>
+				void	insert_range(iterator pos, InputIt first, InputIt last, ft::input_iterator_tag)
+				{
+					if (pos.base() == this->finish)
+					{
+						for (;first != last;++first)
+							this->push_back(*first);
+						return ;
+					}
+					vector	tmp(first, last);
+
+					this->insert_range(pos, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+				}
+
+				template<class ForwardIt>
+				void	insert_range(iterator pos, ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+				{
+					size_type	count = ft::distance(first, last);
+
+					if (count <= size_type(this->end_of_storage - this->finish))
+						this->insert_range_in_place(pos, first, last, count);
+					else
+						this->realloc_insert_range(pos, first, last, count);
 				}
 
 				void	insert_dispatch(iterator pos, size_type count, const_reference value, true_type)
 				{
-					this->realloc_insert_fill(pos, count, value);
+					if (count <= size_type(this->end_of_storage - this->finish))
+						this->insert_fill_in_place(pos, count, value);
+					else
+						this->realloc_insert_fill(pos, count, value);
+				}
+
+				// The in-place inserts below assume capacity() - size() is
+				// enough. Elements past pos are shifted back within the buffer:
+				// the tail part lands on raw storage, the rest is assigned.
+				void	insert_in_place(iterator pos, const_reference value)
+				{
+					if (pos.base() == this->finish)
+					{
+						this->allocator.construct(this->finish, value);
+						++this->finish;
+						return ;
+					}
+					value_type	copy(value);
+
+					ft::uninitialized_move_if_noexcept(this->finish - 1, this->finish, this->finish);
+					++this->finish;
+					ft::move_backward(pos.base(), this->finish - 2, this->finish - 1);
+					*pos = copy;
+				}
+
+				void	insert_fill_in_place(iterator pos, size_type count, const_reference value)
+				{
+					if (count == 0) return ;
+
+					value_type	copy(value);
+					size_type	elems_after = this->finish - pos.base();
+					pointer		old_finish = this->finish;
+
+					if (elems_after > count)
+					{
+						ft::uninitialized_move_if_noexcept(old_finish - count, old_finish, old_finish);
+						this->finish += count;
+						ft::move_backward(pos.base(), old_finish - count, old_finish);
+						ft::fill(pos.base(), pos.base() + count, copy);
+					}
+					else
+					{
+						this->finish = ft::uninitialized_fill_n(old_finish, count - elems_after, copy);
+						this->finish = ft::uninitialized_move_if_noexcept(pos.base(), old_finish, this->finish);
+						ft::fill(pos.base(), old_finish, copy);
+					}
+				}
+
+				template<class ForwardIt>
+				void	insert_range_in_place(iterator pos, ForwardIt first, ForwardIt last, size_type count)
+				{
+					if (count == 0) return ;
+
+					size_type	elems_after = this->finish - pos.base();
+					pointer		old_finish = this->finish;
+
+					if (elems_after > count)
+					{
+						ft::uninitialized_move_if_noexcept(old_finish - count, old_finish, old_finish);
+						this->finish += count;
+						ft::move_backward(pos.base(), old_finish - count, old_finish);
+						ft::copy(first, last, pos.base());
+					}
+					else
+					{
+						ForwardIt	mid = first;
+
+						ft::advance(mid, elems_after);
+						this->finish = ft::uninitialized_copy(mid, last, old_finish);
+						this->finish = ft::uninitialized_move_if_noexcept(pos.base(), old_finish, this->finish);
+						ft::copy(first, mid, pos.base());
+					}
 				}
 
 				void	assign_dispatch(size_type count, const_reference value, true_type)
@@ -423,139 +748,107 @@ namespace ft
 				template<class InputIt>
 				void	assign_dispatch(InputIt first, InputIt last, false_type)
 				{
-					this->assign_range(first, last);
+					this->assign_range(first, last, ft::iterator_category(first));
 				}
 
-				template<class InputIt>
-				void	realloc_insert_range(iterator pos, InputIt first, InputIt last)
-				{
-					if (first == last) return ;
-
-					difference_type	diff = ft::iter_size(first, last);
-					size_type		size = new_size(diff + this->size());
-					pointer			_start(this->allocator.allocate(size));
-					pointer			_finish(_start);
-					
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(this->start, pos.base(), _start);
-					for (; first != last;++first)
-						this->allocator.construct(_finish++, *first);
-					_finish = ft::uninitialized_copy(pos.base(), this->finish, _finish);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _start + size;
-				}
-
-				void	realloc_insert_fill(iterator pos, size_type count, const_reference value)
+				template<class ForwardIt>
+				void	realloc_insert_range(iterator pos, ForwardIt first, ForwardIt last, size_type count)
 				{
 					if (count == 0) return ;
-					
-					size_type	_pos = pos - this->begin();
-					size_type	size = new_size(count + this->size());
-					pointer		_start(this->allocator.allocate(size));
-					pointer		_finish(_start);
-
-					for (size_type i = 0;i < count;i++)
-						this->allocator.construct(_start + _pos + i, value);
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(this->start, pos.base(), _start);
-					_finish += count;
-					_finish = ft::uninitialized_copy(pos.base(), this->finish, _finish);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _start + size;
+
+					this->reallocate(this->new_size(count + this->size()), pos.base(), range_builder<ForwardIt>(first, last));
 				}
 
-				void	realloc_resize_fill(size_type count, const_reference value)
+				void	realloc_insert_fill(iterator pos, size_type count, const_reference value)
 				{
 					if (count == 0) return ;
-					
-					size_type	size = this->size();
-					size_type	new_size = count < size * 2 ? size * 2 : count;
-					pointer		_start(this->allocator.allocate(new_size));
-					pointer		_finish(_start);
-
-					_finish = pointer();
-					_finish = ft::uninitialized_copy(this->start, this->finish, _start);
-					for (size_type i = size;i < count;i++)
-						this->allocator.construct(_finish++, value);
-					this->destroy_it(this->start, this->finish);
-					this->deallocate(this->start, this->end_of_storage - this->start);
-					this->start = _start;
-					this->finish = _finish;
-					this->end_of_storage = _start + new_size;
+
+					this->reallocate(this->new_size(count + this->size()), pos.base(), fill_builder(count, value));
 				}
 
+				// assign reallocates when the new contents do not fit, or when
+				// the Growth policy asks to trim the buffer. Otherwise the live
+				// elements are overwritten and the capacity is kept.
 				void	assign_fill(size_type count, const_reference value)
 				{
-					size_type capacity = this->capacity();
-
-					if (count == 0) return ;
-					if (count > capacity)
+					if (count > this->capacity() || Growth::trim(count, this->capacity()))
 					{
-						this->destroy_it(this->start, this->finish);
-						this->deallocate(this->start, this->capacity());
-						this->start = this->allocator.allocate(count);
-						capacity = count;
+						this->rebuild(this->new_size(count, 0), fill_builder(count, value));
+					}
+					else if (count > this->size())
+					{
+						ft::fill(this->start, this->finish, value);
+						this->finish = ft::uninitialized_fill_n(this->finish, count - this->size(), value);
+					}
+					else
+					{
+						ft::fill(this->start, this->start + count, value);
+						this->erase_at_end(this->start + count);
 					}
-					this->finish = this->start;
-					this->end_of_storage = this->start + capacity;
-					for (size_type i = 0;i < count;i++)
-						this->allocator.construct(this->finish++, value);
 				}
 
+				// Overwrites the live elements first, then either drops the
+				// leftovers or appends the rest of the input.
 				template<class InputIt>
-				void	assign_range(InputIt first, InputIt last)
+				void	assign_range(InputIt first, InputIt last, ft::input_iterator_tag)
+				{
+					pointer	cur = this->start;
+
+					for (;first != last && cur != this->finish;++first, ++cur)
+						*cur = *first;
+					if (first == last)
+						this->erase_at_end(cur);
+					else
+						for (;first != last;++first)
+							this->push_back(*first);
+					if (Growth::trim(this->size(), this->capacity()))
+						this->shrink_to_fit();
+				}
+
+				template<class ForwardIt>
+				void	assign_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
 				{
-					size_type count = ft::iter_size(first, last);
-					size_type capacity = this->capacity();
-					
-					if (first == last) return ;
-					if (count > this->capacity())
+					size_type	count = ft::distance(first, last);
+
+					if (count > this->capacity() || Growth::trim(count, this->capacity()))
+					{
+						this->rebuild(this->new_size(count, 0), range_builder<ForwardIt>(first, last));
+					}
+					else if (count > this->size())
 					{
-						this->destroy_it(this->start, this->finish);
-						this->deallocate(this->start, this->capacity());
-						this->start = this->allocator.allocate(count);
-						capacity = count;
+						ForwardIt	mid = first;
+
+						ft::advance(mid, this->size());
+						ft::copy(first, mid, this->start);
+						this->finish = ft::uninitialized_copy(mid, last, this->finish);
 					}
-					this->finish = this->start;
-					this->end_of_storage = this->start + capacity;
-					for (;first != last;++first)
-						this->allocator.construct(this->finish++, *first);
+					else
+						this->erase_at_end(ft::copy(first, last, this->start));
 				}
 
 				iterator	_erase(iterator pos)
 				{
-					iterator first = this->begin() + (pos - this->begin());
-					
-					if (first + 1 != this->end())
-						for (iterator it = first + 1;it != this->end();++it, (void)++first)
-							*first = *it;
+					ft::move(pos.base() + 1, this->finish, pos.base());
 					--this->finish;
 					this->allocator.destroy(this->finish);
-					return (this->begin() + (pos - this->begin()));
+					return (pos);
 				}
 				
 				iterator	_erase_range(iterator first, iterator last)
 				{
-					iterator _first = first;
-
 					if (first != last)
-					{
-						if (last != end())
-							for (iterator it = last;it != end();++it, ++_first)
-								*_first = *it;
-						this->erase_at_end(&(*_first));
-					}
+						this->erase_at_end(ft::move(last.base(), this->finish, first.base()));
 					return (first);	
 				}
 
-				template<class InputIt>
-				void	destroy_it(InputIt first, InputIt last)
+				void	destroy_it(pointer first, pointer last)
+				{
+					this->destroy_it(first, last, typename ft::is_trivially_destructible<value_type>::type());
+				}
+
+				void	destroy_it(pointer, pointer, true_type) {}
+
+				void	destroy_it(pointer first, pointer last, false_type)
 				{
 					for (;first != last; ++first)
 						this->allocator.destroy(first);
@@ -569,47 +862,59 @@ namespace ft
 				}
 	};
 
-	template<class T, class Allocator>
-	bool	operator==(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator==(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (a.size() == b.size() && ft::equal(a.begin(), a.end(), b.begin()));
 	}
 
-	template<class T, class Allocator>
-	bool	operator!=(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator!=(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (!(a == b));
 	}
 
-	template<class T, class Allocator>
-	bool	operator<(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator<(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
 	}
 
-	template<class T, class Allocator>
-	bool	operator>(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator>(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (b < a);
 	}
 
-	template<class T, class Allocator>
-	bool	operator<=(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator<=(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (!(b < a));
 	}
 
-	template<class T, class Allocator>
-	bool	operator>=(const ft::vector<T, Allocator>& a, const ft::vector<T, Allocator>& b)
+	template<class T, class Allocator, class Growth>
+	bool	operator>=(const ft::vector<T, Allocator, Growth>& a, const ft::vector<T, Allocator, Growth>& b)
 	{
 		return (!(a < b));
 	}
 
-	template< class T, class Alloc >
-	void swap(ft::vector<T, Alloc>& lhs, ft::vector<T, Alloc>& rhs)
+	template< class T, class Alloc, class Growth >
+	void swap(ft::vector<T, Alloc, Growth>& lhs, ft::vector<T, Alloc, Growth>& rhs)
 	{
 		lhs.swap(rhs);
 	}
+
+	// Erases every element matching pred in a single pass and returns how
+	// many were removed.
+	template<class T, class Alloc, class Growth, class Pred>
+	typename ft::vector<T, Alloc, Growth>::size_type	erase_if(ft::vector<T, Alloc, Growth>& c, Pred pred)
+	{
+		typename ft::vector<T, Alloc, Growth>::iterator	last = ft::remove_if(c.begin(), c.end(), pred);
+		typename ft::vector<T, Alloc, Growth>::size_type	count = c.end() - last;
+
+		c.erase(last, c.end());
+		return (count);
+	}
 }
 
 #endif
\ No newline at end of file